@@ -15,6 +15,11 @@ elseif(CMAKE_CXX_COMPILER_ID MATCHES "Clang")
     add_compile_options(-finput-charset=UTF-8)
 endif()
 
+# 按 Klass 统计存活对象和内存占用，供 memstats() 使用，默认关闭
+option(KAUBO_MEMORY_STATS "Track live objects per Klass for memstats()" OFF)
+# 常用对象类型从按线程划分的对象池分配，poolStats() 报告池的计数，默认打开
+option(KAUBO_OBJECT_POOL "Allocate common object types from size-class pools" ON)
+
 include(cmake/BuildSystem.cmake)
 # include(Coverage.cmake)
 include(cmake/Optimizations.cmake)
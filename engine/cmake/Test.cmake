@@ -1,11 +1,20 @@
-# include(FetchContent)
-# FetchContent_Declare(
-#         googletest
-#         GIT_REPOSITORY https://github.com/google/googletest.git
-#         GIT_TAG release-1.12.1  # 指定版本
-# )
-# FetchContent_MakeAvailable(googletest)
-# enable_testing()
-# include_directories(${kaubo_src_dir})
-# include(${kaubo_dir}/test/unittest/Collections/Collections.cmake)
-# include(${kaubo_dir}/test/unittest/Object/Object.cmake)
\ No newline at end of file
+# 单元测试，默认打开；离线配置时可以用 -DKAUBO_BUILD_TESTS=OFF 关闭
+option(KAUBO_BUILD_TESTS "Build the gtest unit tests" ON)
+if (NOT KAUBO_BUILD_TESTS)
+    return()
+endif()
+
+include(FetchContent)
+FetchContent_Declare(
+        googletest
+        GIT_REPOSITORY https://github.com/google/googletest.git
+        GIT_TAG release-1.12.1  # 指定版本
+)
+FetchContent_MakeAvailable(googletest)
+enable_testing()
+include_directories(${kaubo_src_dir})
+include(${kaubo_dir}/test/unittest/Collections/Collections.cmake)
+# MRO 和 eventloop 两个用例还用着已经移除的接口，修好之前不参与构建
+# include(${kaubo_dir}/test/unittest/Object/Object.cmake)
+include(${kaubo_dir}/test/unittest/Object/PyInteger.cmake)
+include(${kaubo_dir}/test/unittest/Object/PyString.cmake)
\ No newline at end of file
@@ -53,6 +53,23 @@ enum class ByteCode : uint8_t {
   MAKE_FUNCTION = 132,
   BUILD_SLICE = 133,
   CALL_FUNCTION = 142,
+  LOAD_METHOD = 160,  // 取方法，不创建绑定了 self 的 PyMethod
+  CALL_METHOD = 161,  // 调用 LOAD_METHOD 取出的方法
+  // 以下为窥孔优化合成的超级指令，只由 PyCode::FuseSuperInstructions 生成
+  LOAD_FAST_LOAD_FAST = 200,   // 连续两次 LOAD_FAST
+  INCREMENT_FAST_CONST = 201,  // LOAD_FAST LOAD_CONST BINARY_ADD STORE_FAST
+  COMPARE_AND_BRANCH = 202,    // COMPARE_OP POP_JUMP_IF_FALSE
+  // 以下为自适应特化指令，只在执行期由 PyFrame::Eval 原地改写生成，
+  // 类型检查失败时退回对应的通用指令，不会出现在序列化的字节码中
+  BINARY_ADD_INT = 210,
+  BINARY_ADD_FLOAT = 211,
+  BINARY_ADD_STR = 212,
+  BINARY_SUBTRACT_INT = 213,
+  BINARY_SUBTRACT_FLOAT = 214,
+  BINARY_MULTIPLY_INT = 215,
+  BINARY_MULTIPLY_FLOAT = 216,
+  BINARY_SUBSCR_LIST_INT = 217,
+  COMPARE_LT_INT = 218,
 };
 
 enum class CompareOp : uint8_t {
@@ -128,7 +145,21 @@ static const std::map<ByteCode, const char*> ByteCodeNames = {
   {ByteCode::MAKE_FUNCTION, "MAKE_FUNCTION"},
   {ByteCode::BUILD_SLICE, "BUILD_SLICE"},
   {ByteCode::CALL_FUNCTION, "CALL_FUNCTION"},
+  {ByteCode::LOAD_METHOD, "LOAD_METHOD"},
+  {ByteCode::CALL_METHOD, "CALL_METHOD"},
   {ByteCode::YIELD_VALUE, "YIELD_VALUE"},
+  {ByteCode::LOAD_FAST_LOAD_FAST, "LOAD_FAST_LOAD_FAST"},
+  {ByteCode::INCREMENT_FAST_CONST, "INCREMENT_FAST_CONST"},
+  {ByteCode::COMPARE_AND_BRANCH, "COMPARE_AND_BRANCH"},
+  {ByteCode::BINARY_ADD_INT, "BINARY_ADD_INT"},
+  {ByteCode::BINARY_ADD_FLOAT, "BINARY_ADD_FLOAT"},
+  {ByteCode::BINARY_ADD_STR, "BINARY_ADD_STR"},
+  {ByteCode::BINARY_SUBTRACT_INT, "BINARY_SUBTRACT_INT"},
+  {ByteCode::BINARY_SUBTRACT_FLOAT, "BINARY_SUBTRACT_FLOAT"},
+  {ByteCode::BINARY_MULTIPLY_INT, "BINARY_MULTIPLY_INT"},
+  {ByteCode::BINARY_MULTIPLY_FLOAT, "BINARY_MULTIPLY_FLOAT"},
+  {ByteCode::BINARY_SUBSCR_LIST_INT, "BINARY_SUBSCR_LIST_INT"},
+  {ByteCode::COMPARE_LT_INT, "COMPARE_LT_INT"},
 };
 
 }  // namespace kaubo::Object
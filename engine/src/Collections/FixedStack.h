@@ -0,0 +1,88 @@
+#pragma once
+#include "Collections/List.h"
+
+#include <gsl/span>
+#include <memory>
+#include <stdexcept>
+namespace kaubo::Collections {
+/**
+ * @brief 定长栈
+ * @details 构造时一次性分配 capacity 个元素的空间，之后不再扩容。
+ * 容量由调用方保证（例如编译期算出的最大栈深度），Release 构建下
+ * Push/Pop 不做越界检查，Debug 构建下越界会抛出异常。
+ * 也可以借用调用方已构造好的存储，此时存储的生命周期由调用方负责。
+ */
+template <typename T>
+class FixedStack {
+ private:
+  std::unique_ptr<T[]> owned;
+  T* slab;
+  Index capacity;
+  Index size = 0;
+
+  void CheckPush() const {
+#ifndef NDEBUG
+    if (size >= capacity) {
+      throw std::overflow_error("FixedStack::Push: stack overflow");
+    }
+#endif
+  }
+
+  void CheckPop(Index k) const {
+#ifndef NDEBUG
+    if (k > size) {
+      throw std::underflow_error("FixedStack::Pop: stack underflow");
+    }
+#else
+    (void)k;
+#endif
+  }
+
+ public:
+  explicit FixedStack(Index capacity)
+    : owned(std::make_unique<T[]>(capacity)),
+      slab(owned.get()),
+      capacity(capacity) {}
+  /**
+   * @brief 在借用的 capacity 个已构造元素上建栈，不接管其所有权
+   */
+  explicit FixedStack(T* storage, Index capacity)
+    : slab(storage), capacity(capacity) {}
+
+  void Push(T value) {
+    CheckPush();
+    slab[size++] = std::move(value);
+  }
+  /**
+   * @brief 弹出栈顶元素，元素被移出，槽位不再持有它
+   */
+  T Pop() {
+    CheckPop(1);
+    return std::move(slab[--size]);
+  }
+  [[nodiscard]] const T& Top() const {
+    CheckPop(1);
+    return slab[size - 1];
+  }
+  /**
+   * @brief 栈顶 k 个元素组成的窗口，按压栈顺序排列，不拷贝
+   */
+  gsl::span<T> Top(Index k) {
+    CheckPop(k);
+    return gsl::span<T>(slab + (size - k), k);
+  }
+  /**
+   * @brief 丢弃栈顶 k 个元素，并释放它们
+   */
+  void Drop(Index k) {
+    CheckPop(k);
+    for (Index i = 0; i < k; i++) {
+      slab[--size] = T();
+    }
+  }
+  List<T> GetContent() const { return List<T>(size, slab); }
+  [[nodiscard]] bool Empty() const { return size == 0; }
+  [[nodiscard]] Index Size() const { return size; }
+  [[nodiscard]] Index Capacity() const { return capacity; }
+};
+}  // namespace kaubo::Collections
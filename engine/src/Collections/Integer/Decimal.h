@@ -3,8 +3,6 @@
 #include "Collections/String/String.h"
 namespace kaubo::Collections {
 
-const uint32_t MaxDecimalPart = 0x10000;
-
 class Decimal {
   friend class List<Decimal>;
   friend class Integer;
@@ -5,207 +5,323 @@
 #include "Collections/String/StringHelper.h"
 
 namespace kaubo::Collections {
-Integer::Integer(const List<uint32_t>& _parts, bool _sign)
-  : parts(_parts), sign(_sign) {}
-Integer::Integer() = default;
-bool Integer::Sign() const {
-  return sign;
-}
-Integer::IntSign Integer::GetSign() const {
-  return sign ? IntSign::Negative : IntSign::Positive;
-}
-String Integer::ToString() const {
-  return CreateDecimalWithInteger(*this).ToString();
-}
-String Integer::ToHexString() const {
-  if (IsZero()) {
-    return CreateStringWithCString("0x0");
-  }
+namespace {
 
-  List<Byte> str;
+constexpr uint64_t LIMB_BASE = uint64_t{1} << Integer::limbBits;
+constexpr uint64_t LIMB_MASK = LIMB_BASE - 1;
 
-  for (Index i = 0; i < parts.Size(); ++i) {
-    uint32_t item = parts.Get(i);
+// 比较两个绝对值，返回 -1、0 或 1
+int CompareMagnitude(const IntegerParts& lhs, const IntegerParts& rhs) {
+  if (lhs.Size() != rhs.Size()) {
+    return lhs.Size() < rhs.Size() ? -1 : 1;
+  }
+  const uint32_t* left = lhs.Data();
+  const uint32_t* right = rhs.Data();
+  for (Index i = lhs.Size(); i-- > 0;) {
+    if (left[i] != right[i]) {
+      return left[i] < right[i] ? -1 : 1;
+    }
+  }
+  return 0;
+}
 
-    // 每个 32 位整数可以拆分为 8 个十六进制字符
-    constexpr uint8_t NIBBLE_BITS = 4;     // 每个十六进制位占4位
-    constexpr uint8_t NIBBLE_MASK = 0x0F;  // 用于提取每个 nibble
-    for (auto j = NIBBLE_BITS - 1; j >= 0; --j) {
-      // 使用无符号类型进行位运算
-      auto nibble =
-        static_cast<uint8_t>((item >> (j * NIBBLE_BITS)) & NIBBLE_MASK);
+IntegerParts AddMagnitude(const IntegerParts& lhs, const IntegerParts& rhs) {
+  const IntegerParts& longer = lhs.Size() >= rhs.Size() ? lhs : rhs;
+  const IntegerParts& shorter = lhs.Size() >= rhs.Size() ? rhs : lhs;
+  IntegerParts result(longer.Size() + 1);
+  const uint32_t* big = longer.Data();
+  const uint32_t* small = shorter.Data();
+  uint64_t carry = 0;
+  for (Index i = 0; i < longer.Size(); i++) {
+    uint64_t sum = carry + big[i];
+    if (i < shorter.Size()) {
+      sum += small[i];
+    }
+    result.Push(static_cast<uint32_t>(sum & LIMB_MASK));
+    carry = sum >> Integer::limbBits;
+  }
+  if (carry != 0) {
+    result.Push(static_cast<uint32_t>(carry));
+  }
+  return result;
+}
 
-      Byte hex_char = (nibble < Decimal::radix)
-                        ? (Byte_0 + nibble)
-                        : (Byte_A + nibble - Decimal::radix);
+// 调用方保证 lhs 的绝对值不小于 rhs
+IntegerParts
+SubtractMagnitude(const IntegerParts& lhs, const IntegerParts& rhs) {
+  IntegerParts result(lhs.Size());
+  const uint32_t* left = lhs.Data();
+  const uint32_t* right = rhs.Data();
+  uint64_t borrow = 0;
+  for (Index i = 0; i < lhs.Size(); i++) {
+    uint64_t sub = borrow + (i < rhs.Size() ? right[i] : 0);
+    uint64_t diff = LIMB_BASE + left[i] - sub;
+    result.Push(static_cast<uint32_t>(diff & LIMB_MASK));
+    borrow = diff < LIMB_BASE ? 1 : 0;
+  }
+  TrimHighZeros(result);
+  return result;
+}
 
-      str.Push(hex_char);
+IntegerParts
+MultiplyMagnitude(const IntegerParts& lhs, const IntegerParts& rhs) {
+  if (lhs.Empty() || rhs.Empty()) {
+    return IntegerParts();
+  }
+  IntegerParts result(lhs.Size() + rhs.Size(), 0U);
+  const uint32_t* left = lhs.Data();
+  const uint32_t* right = rhs.Data();
+  uint32_t* product = result.Data();
+  for (Index i = 0; i < lhs.Size(); i++) {
+    // (2^32-1)^2 + 2 * (2^32-1) 恰好是 2^64-1，累加不会溢出 64 位
+    uint64_t carry = 0;
+    const uint64_t factor = left[i];
+    for (Index j = 0; j < rhs.Size(); j++) {
+      uint64_t t = (factor * right[j]) + product[i + j] + carry;
+      product[i + j] = static_cast<uint32_t>(t & LIMB_MASK);
+      carry = t >> Integer::limbBits;
     }
+    product[i + rhs.Size()] = static_cast<uint32_t>(carry);
   }
+  TrimHighZeros(result);
+  return result;
+}
 
-  // 去除前导零
-  Index iter = 0;
-  while (iter < str.Size() && str.Get(iter) == Byte_0) {
-    ++iter;
+uint32_t LeadingZeros(uint32_t value) noexcept {
+  uint32_t count = 0;
+  while ((value & 0x80000000U) == 0) {
+    value <<= 1;
+    count++;
   }
-  str = str.Slice(iter, str.Size());
+  return count;
+}
 
-  // 添加 "0x" 前缀
-  str.Insert(0, 'x');
-  str.Insert(0, '0');
+/**
+ * 绝对值的除法（Knuth 算法 D），调用方保证除数不为 0；
+ * 单段除数直接逐段相除
+ */
+void DivideMagnitude(
+  const IntegerParts& dividend,
+  const IntegerParts& divisor,
+  IntegerParts& quotient,
+  IntegerParts& remainder
+) {
+  if (CompareMagnitude(dividend, divisor) < 0) {
+    quotient = IntegerParts();
+    remainder = dividend;
+    return;
+  }
+  if (divisor.Size() == 1) {
+    quotient = dividend;
+    uint32_t rest = DivideSmall(quotient, divisor.Get(0));
+    remainder = IntegerParts();
+    if (rest != 0) {
+      remainder.Push(rest);
+    }
+    return;
+  }
+  const Index n = divisor.Size();
+  const Index m = dividend.Size() - n;
+  // 规格化：左移使除数最高段的最高位为 1，试商最多偏大 2
+  const uint32_t shift = LeadingZeros(divisor.Get(n - 1));
+  IntegerParts v(n, 0U);
+  IntegerParts u(dividend.Size() + 1, 0U);
+  const uint32_t* d = divisor.Data();
+  const uint32_t* a = dividend.Data();
+  uint32_t* vn = v.Data();
+  uint32_t* un = u.Data();
+  for (Index i = n - 1; i > 0; i--) {
+    vn[i] = shift == 0 ? d[i]
+                       : (d[i] << shift) | (d[i - 1] >> (32 - shift));
+  }
+  vn[0] = d[0] << shift;
+  un[dividend.Size()] = shift == 0 ? 0 : a[dividend.Size() - 1] >> (32 - shift);
+  for (Index i = dividend.Size() - 1; i > 0; i--) {
+    un[i] = shift == 0 ? a[i] : (a[i] << shift) | (a[i - 1] >> (32 - shift));
+  }
+  un[0] = a[0] << shift;
 
-  return String(std::move(str));
-}
-Integer Integer::Add(const Integer& rhs) const {  // NOLINT(misc-no-recursion)
-  if (sign == rhs.sign) {
-    uint32_t carry = 0;
-    List<uint32_t> result;
-    for (Index i = parts.Size() - 1, j = rhs.parts.Size() - 1;
-         ((~i) != 0U) || ((~j) != 0U);) {
-      uint32_t sum = carry;
-      if ((~i) != 0U) {
-        sum += parts.Get(i);
-        --i;
+  quotient = IntegerParts(m + 1, 0U);
+  uint32_t* q = quotient.Data();
+  for (Index j = m + 1; j-- > 0;) {
+    const uint64_t top = (uint64_t{un[j + n]} << 32) | un[j + n - 1];
+    uint64_t qhat = top / vn[n - 1];
+    uint64_t rhat = top % vn[n - 1];
+    while (qhat >= LIMB_BASE ||
+           qhat * vn[n - 2] > ((rhat << 32) | un[j + n - 2])) {
+      qhat--;
+      rhat += vn[n - 1];
+      if (rhat >= LIMB_BASE) {
+        break;
       }
-      if ((~j) != 0U) {
-        sum += rhs.parts.Get(j);
-        --j;
-      }
-      // 进位是高16位
-      carry = (sum >> significantBits) & low16Mask;
-      sum &= low16Mask;
-      result.Push(sum);
     }
-    if (carry != 0) {
-      result.Push(carry);
+    // 从 un[j..j+n] 中减去 qhat * vn
+    int64_t borrow = 0;
+    uint64_t carry = 0;
+    for (Index i = 0; i < n; i++) {
+      uint64_t product = (qhat * vn[i]) + carry;
+      carry = product >> 32;
+      int64_t t = static_cast<int64_t>(un[i + j]) - borrow -
+                  static_cast<int64_t>(product & LIMB_MASK);
+      un[i + j] = static_cast<uint32_t>(t);
+      borrow = t < 0 ? 1 : 0;
+    }
+    int64_t t = static_cast<int64_t>(un[j + n]) - borrow -
+                static_cast<int64_t>(carry);
+    un[j + n] = static_cast<uint32_t>(t);
+    if (t < 0) {
+      // 试商偏大 1，加回一个除数
+      qhat--;
+      uint64_t sum = 0;
+      for (Index i = 0; i < n; i++) {
+        sum = uint64_t{un[i + j]} + vn[i] + (sum >> 32);
+        un[i + j] = static_cast<uint32_t>(sum);
+      }
+      un[j + n] += static_cast<uint32_t>(sum >> 32);
     }
-    result.Reverse();
-    return Integer(result, sign);
+    q[j] = static_cast<uint32_t>(qhat);
+  }
+  TrimHighZeros(quotient);
+  // 余数是 un 的低 n 段右移回去
+  remainder = IntegerParts(n, 0U);
+  uint32_t* r = remainder.Data();
+  for (Index i = 0; i < n; i++) {
+    r[i] = shift == 0 ? un[i] : (un[i] >> shift) | (un[i + 1] << (32 - shift));
   }
-  return Subtract(Integer(rhs.parts, !rhs.sign));
+  TrimHighZeros(remainder);
 }
 
-Integer Integer::Copy() const {
-  Integer newInteger;
-  newInteger.parts = parts.Copy();
-  newInteger.sign = sign;
-  return newInteger;
-}
-bool Integer::GreaterThan(const Integer& rhs) const {
-  bool lzero = IsZero();
-  bool rzero = rhs.IsZero();
-  if (lzero && rzero) {
-    return false;
-  }
-  if (lzero) {
-    return rhs.sign;
+/**
+ * 取 width 段的补码：非负数补零，负数按位取反后加一
+ */
+IntegerParts ToTwosComplement(const Integer& value, Index width) {
+  IntegerParts result(width, 0U);
+  const auto& magnitude = value.Data();
+  std::copy(
+    magnitude.Data(), magnitude.Data() + magnitude.Size(), result.Data()
+  );
+  if (!value.Sign()) {
+    return result;
   }
-  if (rzero) {
-    return !sign;
+  uint64_t carry = 1;
+  for (Index i = 0; i < width; i++) {
+    uint64_t t = uint64_t{static_cast<uint32_t>(~result.Get(i))} + carry;
+    result.Set(i, static_cast<uint32_t>(t & LIMB_MASK));
+    carry = t >> Integer::limbBits;
   }
-  // 如果左值是负数，右值是正数，那么左值一定比右值小
-  if (sign && !rhs.sign) {
-    return false;
+  return result;
+}
+
+// 由补码还原符号和绝对值，negative 表示最高位为 1
+Integer FromTwosComplement(IntegerParts bits, bool negative) {
+  if (negative) {
+    uint64_t carry = 1;
+    for (Index i = 0; i < bits.Size(); i++) {
+      uint64_t t = uint64_t{static_cast<uint32_t>(~bits.Get(i))} + carry;
+      bits.Set(i, static_cast<uint32_t>(t & LIMB_MASK));
+      carry = t >> Integer::limbBits;
+    }
   }
-  // 如果左值是正数，右值是负数，那么左值一定比右值大
-  if (!sign && rhs.sign) {
-    return true;
+  return Integer(std::move(bits), negative);
+}
+
+template <typename Operation>
+Integer
+BitWise(const Integer& lhs, const Integer& rhs, Operation operation) {
+  // 多留一段存放符号位
+  const Index width = std::max(lhs.Data().Size(), rhs.Data().Size()) + 1;
+  IntegerParts left = ToTwosComplement(lhs, width);
+  IntegerParts right = ToTwosComplement(rhs, width);
+  for (Index i = 0; i < width; i++) {
+    left.Set(i, operation(left.Get(i), right.Get(i)));
+  }
+  const bool negative = (left.Get(width - 1) & 0x80000000U) != 0;
+  return FromTwosComplement(std::move(left), negative);
+}
+
+}  // namespace
+
+Integer::Integer(IntegerParts _parts, bool _sign)
+  : parts(std::move(_parts)), sign(_sign) {
+  TrimHighZeros(parts);
+  if (parts.Empty()) {
+    sign = false;
   }
-  // 此时左值和右值正负号相同
-  if (parts.Size() != rhs.parts.Size()) {
-    // 正号，位数多的数大；负号，位数少的数大
-    return sign ^ (parts.Size() > rhs.parts.Size());
+}
+Integer::Integer() = default;
+bool Integer::Sign() const {
+  return sign;
+}
+Integer::IntSign Integer::GetSign() const {
+  return sign ? IntSign::Negative : IntSign::Positive;
+}
+String Integer::ToString() const {
+  return CreateDecimalWithInteger(*this).ToString();
+}
+String Integer::ToHexString() const {
+  if (IsZero()) {
+    return CreateStringWithCString("0x0");
   }
-  // 此时左值和右值的位数相等，正负号相同
-  for (Index i = 0; i < parts.Size(); i++) {
-    if (parts.Get(i) == rhs.parts.Get(i)) {
-      continue;
-    }
-    return sign ^ (parts.Get(i) > rhs.parts.Get(i));
-  }
-  return false;
-}
-Integer Integer::Subtract(  // NOLINT(misc-no-recursion)
-  const Integer& rhs
-) const {
-  // 正负号相同
-  if (sign == rhs.sign) {
-    // 假定左值大于右值
-    bool _sign = false;
-    Index size = 0;
-    List<uint32_t> _lhs = parts.Copy();
-    _lhs.Reverse();
-    List<uint32_t> _rhs = rhs.parts.Copy();
-    _rhs.Reverse();
-    if (_lhs.Size() > _rhs.Size()) {
-      _rhs.Concat(
-        List<uint32_t>(_lhs.Size() - _rhs.Size(), static_cast<uint32_t>(0))
-      );
-      size = _lhs.Size();
-    } else if (_lhs.Size() < _rhs.Size()) {
-      _lhs.Concat(
-        List<uint32_t>(_rhs.Size() - _lhs.Size(), static_cast<uint32_t>(0))
-      );
-      size = _rhs.Size();
-      _sign = true;
-      std::swap(_lhs, _rhs);
-    } else {
-      size = _lhs.Size();
-      for (Index i = size - 1; (~i) != 0U; --i) {
-        if (_lhs.Get(i) > _rhs.Get(i)) {
-          break;
-        }
-        if (_lhs.Get(i) < _rhs.Get(i)) {
-          _sign = true;
-          std::swap(_lhs, _rhs);
-          break;
-        }
-      }
-    }
-    List<uint32_t> result(size);
-    bool borrow = false;
-    for (Index i = 0; i < size; i++) {
-      uint32_t diff = 0;
-      uint32_t sub = _rhs.Get(i) + (borrow ? 1 : 0);
-      if (_lhs.Get(i) < sub) {
-        diff = low16Mask + 1 + _lhs.Get(i) - sub;
-        borrow = true;
-      } else {
-        diff = _lhs.Get(i) - sub;
-        borrow = false;
+  constexpr uint32_t NIBBLE_BITS = 4;
+  constexpr uint32_t NIBBLES = limbBits / NIBBLE_BITS;
+  List<Byte> str(2 + (parts.Size() * NIBBLES));
+  str.Push(Byte_0);
+  str.Push('x');
+  bool leading = true;
+  for (Index i = parts.Size(); i-- > 0;) {
+    const uint32_t item = parts.Get(i);
+    for (uint32_t j = NIBBLES; j-- > 0;) {
+      auto nibble = static_cast<uint8_t>((item >> (j * NIBBLE_BITS)) & 0x0F);
+      if (leading && nibble == 0) {
+        continue;
       }
-      result.Push(diff);
+      leading = false;
+      str.Push(HexToByte(nibble));
     }
-    TrimTrailingZero(result);
-    result.Reverse();
-    return Integer(result, _sign ^ sign);
   }
-  return Add(Integer(rhs.parts, !rhs.sign));
+  return String(std::move(str));
+}
+Integer Integer::AddMagnitudes(
+  const IntegerParts& lhs,
+  bool lhsSign,
+  const IntegerParts& rhs,
+  bool rhsSign
+) {
+  if (lhsSign == rhsSign) {
+    return Integer(AddMagnitude(lhs, rhs), lhsSign);
+  }
+  // 异号相加即绝对值相减，结果取绝对值较大一方的符号
+  int order = CompareMagnitude(lhs, rhs);
+  if (order == 0) {
+    return Integer();
+  }
+  if (order > 0) {
+    return Integer(SubtractMagnitude(lhs, rhs), lhsSign);
+  }
+  return Integer(SubtractMagnitude(rhs, lhs), rhsSign);
+}
+Integer Integer::Add(const Integer& rhs) const {
+  return AddMagnitudes(parts, sign, rhs.parts, rhs.sign);
+}
+
+Integer Integer::Copy() const {
+  return *this;
+}
+bool Integer::GreaterThan(const Integer& rhs) const {
+  if (sign != rhs.sign) {
+    return rhs.sign;
+  }
+  int order = CompareMagnitude(parts, rhs.parts);
+  return sign ? order < 0 : order > 0;
+}
+Integer Integer::Subtract(const Integer& rhs) const {
+  return AddMagnitudes(parts, sign, rhs.parts, !rhs.sign);
 }
 Integer Integer::Multiply(const Integer& rhs) const {
   if (IsZero() || rhs.IsZero()) {
-    return CreateIntegerZero();
-  }
-  List<uint32_t> result(parts.Size() + rhs.parts.Size() + 1);
-  result.Fill(0);
-  auto _lhs = parts;
-  _lhs.Reverse();
-  auto _rhs = rhs.parts;
-  _rhs.Reverse();
-  for (Index i = 0; i < _lhs.Size(); i++) {
-    for (Index j = 0; j < _rhs.Size(); j++) {
-      uint32_t product = _lhs.Get(i) * _rhs.Get(j);
-      Index index = i + j;
-      result.Set(index, result.Get(index) + product);
-      result.Set(
-        index + 1, result.Get(index + 1) + (result.Get(index) >> Integer::radix)
-      );
-      result.Set(index, (result.Get(index) & low16Mask));
-    }
+    return Integer();
   }
-  TrimTrailingZero(result);
-  result.Reverse();
-  return Integer(result, sign ^ rhs.sign);
+  return Integer(MultiplyMagnitude(parts, rhs.parts), sign ^ rhs.sign);
 }
 Integer Integer::Divide(const Integer& rhs) const {
   return DivMod(rhs).Get(0);
@@ -217,121 +333,48 @@ List<Integer> Integer::DivMod(const Integer& rhs) const {
   if (rhs.IsZero()) {
     throw std::runtime_error("Division by zero");
   }
-  if (IsZero() || LessThan(rhs)) {
-    return List<Integer>({CreateIntegerZero(), Copy()});
-  }
-  if (Equal(rhs)) {
-    return List<Integer>({CreateIntegerOne(), CreateIntegerZero()});
-  }
-  Integer result;
-  result.sign = sign ^ rhs.sign;
-  Integer dividend =
-    Slice(*this, 0, std::min(parts.Size(), rhs.parts.Size())).Copy();
-  dividend.sign = false;
-  Integer divisor = rhs.Copy();
-  divisor.sign = false;
-  for (Index i = 0; i < parts.Size() - rhs.parts.Size() + 1; i++) {
-    uint32_t quotient = 0;
-    while (dividend.GreaterThanOrEqual(divisor)) {
-      dividend = dividend.Subtract(divisor);
-      quotient++;
-    }
-    result.parts.Push(quotient);
-    if (i + rhs.parts.Size() < parts.Size()) {
-      dividend.parts.Push(parts.Get(i + rhs.parts.Size()));
-    }
-    TrimLeadingZero(dividend.parts);
-  }
-  List<Integer> divmods;
-  TrimTrailingZero(result.parts);
-  TrimTrailingZero(dividend.parts);
-  divmods.Push(result);
-  divmods.Push(dividend);
-  return divmods;
+  IntegerParts quotient;
+  IntegerParts remainder;
+  DivideMagnitude(parts, rhs.parts, quotient, remainder);
+  Integer q(std::move(quotient), sign ^ rhs.sign);
+  Integer r(std::move(remainder), sign);
+  // 向下取整：异号且有余数时商减一，余数与除数同号
+  if (sign != rhs.sign && !r.IsZero()) {
+    q = q.Subtract(CreateIntegerOne());
+    r = r.Add(rhs);
+  }
+  return List<Integer>({q, r});
 }
 bool Integer::IsZero() const {
-  if (parts.Size() == 0) {
-    return true;
-  }
-  for (Index i = 0; i < parts.Size(); i++) {
-    if (parts.Get(i) != 0) {
-      return false;
-    }
-  }
-  return true;
+  return parts.Empty();
 }
 bool Integer::Equal(const Integer& rhs) const {
-  if (IsZero() && rhs.IsZero()) {
-    return true;
-  }
-  if (sign != rhs.sign) {
-    return false;
-  }
-  if (parts.Size() != rhs.parts.Size()) {
-    return false;
-  }
-  for (Index i = 0; i < parts.Size(); i++) {
-    if (parts.Get(i) != rhs.parts.Get(i)) {
-      return false;
-    }
-  }
-  return true;
+  return sign == rhs.sign && CompareMagnitude(parts, rhs.parts) == 0;
 }
 Integer Integer::BitWiseAnd(const Integer& rhs) const {
-  List<uint32_t> result(std::max(parts.Size(), rhs.parts.Size()));
-  for (Index i = parts.Size() - 1, j = rhs.parts.Size() - 1;
-       ((~i) != 0U) || ((~j) != 0U); --i, --j) {
-    if (((~i) == 0U) || ((~j) == 0U)) {
-      result.Push(0);
-    } else {
-      result.Push(parts.Get(i) & rhs.parts.Get(j));
-    }
-  }
-  result.Reverse();
-  return Integer(result, sign ^ rhs.sign);
+  return BitWise(*this, rhs, [](uint32_t left, uint32_t right) {
+    return left & right;
+  });
 }
 Integer Integer::BitWiseOr(const Integer& rhs) const {
-  List<uint32_t> result(std::max(parts.Size(), rhs.parts.Size()));
-  for (Index i = parts.Size() - 1, j = rhs.parts.Size() - 1;
-       ((~i) != 0U) || ((~j) != 0U); --i, --j) {
-    if ((~i) == 0U) {
-      result.Push(rhs.parts[j]);
-    } else if ((~j) == 0U) {
-      result.Push(parts[i]);
-    } else {
-      result.Push(parts[i] | rhs.parts[j]);
-    }
-  }
-  result.Reverse();
-  return Integer(result, sign ^ rhs.sign);
+  return BitWise(*this, rhs, [](uint32_t left, uint32_t right) {
+    return left | right;
+  });
 }
 Integer Integer::BitWiseXor(const Integer& rhs) const {
-  List<uint32_t> result(std::max(parts.Size(), rhs.parts.Size()));
-  for (Index i = parts.Size() - 1, j = rhs.parts.Size() - 1;
-       ((~i) != 0U) || ((~j) != 0U); --i, --j) {
-    if ((~i) == 0U) {
-      result.Push(rhs.parts[j]);
-    } else if ((~j) == 0U) {
-      result.Push(parts[i]);
-    } else {
-      result.Push(parts[i] ^ rhs.parts[j]);
-    }
-  }
-  result.Reverse();
-  return Integer(result, sign ^ rhs.sign);
+  return BitWise(*this, rhs, [](uint32_t left, uint32_t right) {
+    return left ^ right;
+  });
 }
 Integer Integer::BitWiseNot() const {
-  List<uint32_t> result(parts.Size());
-  for (Index i = 0; i < parts.Size(); i++) {
-    result.Push(~parts.Get(i));
-  }
-  return Integer(result, !sign);
+  // ~x == -x - 1
+  return AddMagnitudes(parts, !sign, CreateIntegerOne().parts, true);
 }
 bool Integer::LessThan(const Integer& rhs) const {
-  return !GreaterThan(rhs) && !Equal(rhs);
+  return rhs.GreaterThan(*this);
 }
 bool Integer::GreaterThanOrEqual(const Integer& rhs) const {
-  return GreaterThan(rhs) || Equal(rhs);
+  return !rhs.GreaterThan(*this);
 }
 bool Integer::LessThanOrEqual(const Integer& rhs) const {
   return !GreaterThan(rhs);
@@ -339,9 +382,6 @@ bool Integer::LessThanOrEqual(const Integer& rhs) const {
 bool Integer::NotEqual(const Integer& rhs) const {
   return !Equal(rhs);
 }
-List<uint32_t> Integer::Data() const {
-  return parts;
-}
 
 Integer Integer::Negate() const {
   return Integer(parts, !sign);
@@ -351,83 +391,76 @@ Integer Integer::Power(const Integer& rhs) const {
   if (rhs.sign) {
     throw std::runtime_error("Exponent must be non-negative");
   }
-  if (rhs.IsZero()) {
-    return CreateIntegerOne();
-  }
-  if (rhs.Equal(CreateIntegerOne())) {
-    return Copy();
-  }
-  if (rhs.Equal(CreateIntegerTwo())) {
-    return Multiply(*this);
-  }
+  // 从低位到高位逐位扫描指数，平方和乘法都直接在分段上进行
   Integer result = CreateIntegerOne();
-  Integer base = Copy();
-  Integer exponent = rhs.Copy();
-  while (!exponent.IsZero()) {
-    if ((exponent.parts.Get(0) & 1) != 0U) {
-      result = result.Multiply(base);
+  IntegerParts base = parts;
+  for (Index i = 0; i < rhs.parts.Size(); i++) {
+    uint32_t bits = rhs.parts.Get(i);
+    const bool last = i + 1 == rhs.parts.Size();
+    for (uint32_t j = 0; j < limbBits; j++) {
+      if ((bits & 1U) != 0) {
+        result.parts = MultiplyMagnitude(result.parts, base);
+      }
+      bits >>= 1;
+      if (last && bits == 0) {
+        break;
+      }
+      base = MultiplyMagnitude(base, base);
     }
-    base = base.Multiply(base);
-    exponent = exponent.RightShift(CreateIntegerOne());
   }
-  return result;
+  // 负数的奇数次幂为负
+  const bool odd = !rhs.IsZero() && (rhs.parts.Get(0) & 1U) != 0;
+  return Integer(std::move(result.parts), sign && odd);
 }
 
 Integer Integer::LeftShift(const Integer& rhs) const {
   if (rhs.sign) {
     throw std::runtime_error("Shift count must be non-negative");
   }
-  if (rhs.IsZero()) {
+  if (rhs.IsZero() || IsZero()) {
     return Copy();
   }
-
-  // 计算总位移量（使用uint64_t防止32位溢出）
-  uint64_t totalShift = ToU64(rhs);
-  uint64_t blockShift = ((totalShift - 1) / Integer::radix) + 1;
-  uint64_t bitShift = totalShift % Integer::radix;
-  if (bitShift != 0) {
-    bitShift = Integer::radix - bitShift;
-  }
-  Integer result = Copy();
-  result.parts.ExpandWithElement(result.parts.Size() + blockShift, 0);
-  if (bitShift == 0) {
-    return result;
+  const uint64_t totalShift = ToU64(rhs);
+  const Index limbShift = totalShift / limbBits;
+  const uint32_t bitShift = totalShift % limbBits;
+  IntegerParts result(parts.Size() + limbShift + 1, 0U);
+  uint32_t* shifted = result.Data();
+  const uint32_t* source = parts.Data();
+  for (Index i = 0; i < parts.Size(); i++) {
+    const uint64_t wide = uint64_t{source[i]} << bitShift;
+    shifted[i + limbShift] |= static_cast<uint32_t>(wide & LIMB_MASK);
+    shifted[i + limbShift + 1] |= static_cast<uint32_t>(wide >> limbBits);
   }
-  Integer IntBitShift = CreateIntegerWithU64(bitShift);
-  return result.RightShift(IntBitShift);
+  return Integer(std::move(result), sign);
 }
 
 Integer Integer::RightShift(const Integer& rhs) const {
   if (rhs.sign) {
     throw std::runtime_error("Shift count must be non-negative");
   }
-  if (rhs.IsZero()) {
+  if (rhs.IsZero() || IsZero()) {
     return Copy();
   }
-  // 计算总位移量
-  uint64_t totalShift = ToU64(rhs);
-  // 如果总位移量超过最大范围，直接返回0
-  if (totalShift >= Integer::radix * parts.Size()) {
-    return CreateIntegerZero();
-  }
-  Integer result = Copy();
-  uint64_t blockShift = totalShift / Integer::radix;
-  uint64_t bitShift = totalShift % Integer::radix;
-  result.parts.RemoveRange(result.parts.Size() - 1 - blockShift, blockShift);
-  if (bitShift == 0) {
-    return result;
+  if (sign) {
+    // 负数向下取整：x >> n == -((-x - 1) >> n) - 1
+    return BitWiseNot().RightShift(rhs).BitWiseNot();
+  }
+  const uint64_t totalShift = ToU64(rhs);
+  if (totalShift >= uint64_t{limbBits} * parts.Size()) {
+    return Integer();
+  }
+  const Index limbShift = totalShift / limbBits;
+  const uint32_t bitShift = totalShift % limbBits;
+  const Index size = parts.Size() - limbShift;
+  IntegerParts result(size);
+  const uint32_t* source = parts.Data() + limbShift;
+  for (Index i = 0; i < size; i++) {
+    uint64_t wide = source[i];
+    if (i + 1 < size) {
+      wide |= uint64_t{source[i + 1]} << limbBits;
+    }
+    result.Push(static_cast<uint32_t>((wide >> bitShift) & LIMB_MASK));
   }
-  uint32_t overflowPicker = (1 << (bitShift + 1)) - 1;
-  for (Index i = result.parts.Size() - 2; (~i) != 0U; i--) {
-    uint32_t high = result.parts.Get(i);
-    uint32_t low = result.parts.Get(i + 1);
-    low >>= bitShift;
-    high &= overflowPicker;
-    high = (high << (Integer::radix - bitShift)) & low16Mask;
-    result.parts.Set(i + 1, low | high);
-  }
-  result.parts.Set(0, result.parts.Get(0) >> bitShift);
-  TrimLeadingZero(result.parts);
-  return result;
+  return Integer(std::move(result), false);
 }
-}  // namespace kaubo::Collections
\ No newline at end of file
+}  // namespace kaubo::Collections
@@ -4,22 +4,43 @@
 #include "Collections/String/String.h"
 
 namespace kaubo::Collections {
+/**
+ * @brief 大整数的分段，不超过两段的整数不向堆申请内存
+ */
+using IntegerParts = List<uint32_t, 2>;
+/**
+ * @brief 符号加绝对值表示的大整数
+ * @details 绝对值按 2^32 进制存放，每段用满 32 位，低位段在前；
+ * 最高段不为 0，零没有分段且符号为正。段间运算用 64 位中间值承接进位和借位
+ */
 class Integer {
   friend class List<Integer>;
 
  private:
-  List<uint32_t> parts;
+  IntegerParts parts;
   bool sign = false;
 
+  static Integer AddMagnitudes(
+    const IntegerParts& lhs,
+    bool lhsSign,
+    const IntegerParts& rhs,
+    bool rhsSign
+  );
+
  public:
-  static const uint32_t radix = 16;
-  static const uint32_t significantBits = 16;  // 高16位只用于加法进位和乘法进位
-  static const uint32_t low16Mask = 0xFFFF;
+  static const uint32_t limbBits = 32;
 
   enum class IntSign : uint8_t { Positive = 0, Negative = 1 };
   explicit Integer();
-  explicit Integer(const List<uint32_t>& _parts, bool _sign);
-  [[nodiscard]] List<uint32_t> Data() const;
+  /**
+   * @brief 由低位在前的分段构造，多余的高位零段会被去掉
+   */
+  explicit Integer(IntegerParts _parts, bool _sign);
+  /**
+   * @brief 绝对值的分段，低位在前
+   */
+  [[nodiscard]] const IntegerParts& Data() const { return parts; }
+  [[nodiscard]] Index HeapBytes() const { return parts.HeapBytes(); }
   [[nodiscard]] bool Sign() const;
   [[nodiscard]] IntSign GetSign() const;
   [[nodiscard]] String ToHexString() const;
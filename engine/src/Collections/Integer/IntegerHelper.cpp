@@ -5,8 +5,24 @@
 #include "Collections/String/StringHelper.h"
 #include "Common.h"
 
+#include <limits>
 #include <stdexcept>
 namespace kaubo::Collections {
+namespace {
+// 10^9 是 32 位内最大的 10 的幂，十进制互转时每次处理 9 位
+constexpr uint32_t DecimalChunk = 1000000000;
+constexpr uint32_t DecimalChunkDigits = 9;
+constexpr Index U64Limbs = 64 / Integer::limbBits;
+
+// 调用方保证不超过 U64Limbs 段
+uint64_t Magnitude64(const IntegerParts& parts) {
+  uint64_t result = 0;
+  for (Index i = parts.Size(); i-- > 0;) {
+    result = (result << Integer::limbBits) | parts.Get(i);
+  }
+  return result;
+}
+}  // namespace
 int8_t ByteToHex(Byte byte) noexcept {
   if (byte >= Byte_0 && byte <= Byte_9) {
     return static_cast<int8_t>(byte - Byte_0);
@@ -41,7 +57,7 @@ Byte HexToByte(uint8_t hex) noexcept {
 Integer CreateIntegerWithString(const String& str) {
   if (str.GetCodeUnitCount() > 2 && str.GetCodeUnit(0) == Byte_0 &&
       (str.GetCodeUnit(1) == Byte_x || str.GetCodeUnit(1) == Byte_X)) {
-    List<uint32_t> parts;
+    IntegerParts parts;
     uint32_t buffer = 0;
     uint32_t count = 0;
     for (Index i = str.GetCodeUnitCount() - 1; i >= 2; i--) {
@@ -51,7 +67,7 @@ Integer CreateIntegerWithString(const String& str) {
       }
       buffer = (static_cast<uint32_t>(value) << (count * 4)) | buffer;
       count++;
-      if (count == 4) {
+      if (count == Integer::limbBits / 4) {
         parts.Push(buffer);
         buffer = 0;
         count = 0;
@@ -60,8 +76,7 @@ Integer CreateIntegerWithString(const String& str) {
     if (count != 0) {
       parts.Push(buffer);
     }
-    parts.Reverse();
-    return Integer(parts, false);
+    return Integer(std::move(parts), false);
   }
   return CreateIntegerWithDecimal(CreateDecimalWithString(str));
 }
@@ -69,60 +84,78 @@ Integer CreateIntegerWithCString(const char* str) {
   return CreateIntegerWithString(CreateStringWithCString(str));
 }
 Decimal CreateDecimalWithInteger(const Integer& integer) {
-  Decimal decimal = CreateDecimalZero();
-  const auto& parts = integer.Data();
-  for (Index i = 0; i < parts.Size(); i++) {
-    Decimal temp = CreateDecimalWithU32(parts.Get(i));
-    decimal = decimal.Multiply(CreateDecimalWithU32(MaxDecimalPart)).Add(temp);
+  // 反复除以 10^9，每次取下低位的 9 个十进制数字
+  IntegerParts magnitude = integer.Data();
+  List<int32_t> digits;
+  while (!magnitude.Empty()) {
+    uint32_t chunk = DivideSmall(magnitude, DecimalChunk);
+    for (uint32_t i = 0; i < DecimalChunkDigits; i++) {
+      if (magnitude.Empty() && chunk == 0) {
+        break;
+      }
+      digits.Push(static_cast<int32_t>(chunk % Decimal::radix));
+      chunk /= Decimal::radix;
+    }
   }
-  return Decimal(decimal.Data(), integer.Sign());
+  digits.Reverse();
+  return Decimal(digits, integer.Sign());
 }
 Integer CreateIntegerWithDecimal(const Decimal& decimal) {
-  List<uint32_t> parts;
-  Decimal temp = decimal.Copy();
-  Decimal num65536(CreateDecimalWithString(CreateStringWithCString("65536")));
-  while (!temp.IsZero()) {
-    List<Decimal> divmod = temp.DivMod(num65536);
-    temp = divmod.Get(0);
-    Decimal remainder = divmod.Get(1);
-    int32_t value = 0;
-    for (Index i = 0; i < remainder.Data().Size(); i++) {
-      value = value * Decimal::radix + remainder.Data().Get(i);
+  // 每攒够 9 位十进制数字做一次原地乘加
+  IntegerParts parts;
+  const auto digits = decimal.Data();
+  uint32_t chunk = 0;
+  uint32_t scale = 1;
+  for (Index i = 0; i < digits.Size(); i++) {
+    chunk = chunk * Decimal::radix + static_cast<uint32_t>(digits.Get(i));
+    scale *= Decimal::radix;
+    if (scale == DecimalChunk) {
+      MultiplyAdd(parts, scale, chunk);
+      chunk = 0;
+      scale = 1;
     }
-    parts.Push(static_cast<uint32_t>(value));
   }
-  parts.Reverse();
-  Integer result(parts, decimal.Sign());
-  return result;
+  if (scale != 1) {
+    MultiplyAdd(parts, scale, chunk);
+  }
+  return Integer(std::move(parts), decimal.Sign());
 }
-void TrimTrailingZero(List<uint32_t>& parts) {
-  for (Index i = parts.Size() - 1; (~i) != 0U; i--) {
-    if (parts.Get(i) != 0 || i == 0) {
-      parts = parts.Slice(0, i + 1);
-      break;
-    }
+void TrimHighZeros(IntegerParts& parts) {
+  while (!parts.Empty() && parts.Last() == 0) {
+    parts.Pop();
   }
 }
-void TrimLeadingZero(List<uint32_t>& parts) {
+void MultiplyAdd(IntegerParts& parts, uint32_t multiplier, uint32_t addend) {
+  uint64_t carry = addend;
+  uint32_t* data = parts.Data();
   for (Index i = 0; i < parts.Size(); i++) {
-    if (parts.Get(i) != 0 || i == parts.Size() - 1) {
-      parts = parts.Slice(i, parts.Size());
-      break;
-    }
+    uint64_t product = (uint64_t{data[i]} * multiplier) + carry;
+    data[i] = static_cast<uint32_t>(product);
+    carry = product >> Integer::limbBits;
+  }
+  if (carry != 0) {
+    parts.Push(static_cast<uint32_t>(carry));
   }
 }
-Integer Slice(const Integer& integer, Index start, Index end) {
-  List<uint32_t> parts = integer.Data().Slice(start, end);
-  return Integer(parts, integer.Sign());
+uint32_t DivideSmall(IntegerParts& parts, uint32_t divisor) {
+  uint64_t rest = 0;
+  uint32_t* data = parts.Data();
+  for (Index i = parts.Size(); i-- > 0;) {
+    uint64_t current = (rest << Integer::limbBits) | data[i];
+    data[i] = static_cast<uint32_t>(current / divisor);
+    rest = current % divisor;
+  }
+  TrimHighZeros(parts);
+  return static_cast<uint32_t>(rest);
 }
 Integer CreateIntegerZero() {
-  return Integer(List<uint32_t>({0}), false);
+  return Integer();
 }
 Integer CreateIntegerOne() {
-  return Integer(List<uint32_t>({1}), false);
+  return Integer(IntegerParts({1}), false);
 }
 Integer CreateIntegerTwo() {
-  return Integer(List<uint32_t>({2}), false);
+  return Integer(IntegerParts({2}), false);
 }
 uint64_t ToU64(const Integer& integer) {
   if (integer.IsZero()) {
@@ -131,28 +164,22 @@ uint64_t ToU64(const Integer& integer) {
   if (integer.Sign()) {
     throw std::runtime_error("Negative integer cannot be converted to index");
   }
-  auto data = integer.Data();
-  if (data.Size() > 4) {
+  if (IsBigNumber(integer)) {
     throw std::runtime_error("Integer is too large to be converted to index");
   }
-  Index result = 0;
-  for (Index i = 0; i < data.Size(); i++) {
-    result = (result << Integer::radix) | data.Get(i);
-  }
-  return result;
+  return Magnitude64(integer.Data());
 }
 Integer CreateIntegerWithU64(uint64_t value, bool sign) {
-  List<uint32_t> parts;
+  IntegerParts parts;
   while (value != 0) {
-    parts.Push(value & Integer::low16Mask);
-    value >>= Integer::radix;
+    parts.Push(static_cast<uint32_t>(value));
+    value >>= Integer::limbBits;
   }
-  parts.Reverse();
-  return Integer(parts, sign);
+  return Integer(std::move(parts), sign);
 }
 
 bool IsBigNumber(const Integer& integer) {
-  return integer.Data().Size() > 4;
+  return integer.Data().Size() > U64Limbs;
 }
 
 Integer CreateIntegerWithI64(int64_t value) {
@@ -160,7 +187,8 @@ Integer CreateIntegerWithI64(int64_t value) {
     return CreateIntegerZero();
   }
   if (value < 0) {
-    return CreateIntegerWithU64(static_cast<uint64_t>(-value), true);
+    // 按无符号取反，INT64_MIN 的绝对值也不会溢出
+    return CreateIntegerWithU64(0 - static_cast<uint64_t>(value), true);
   }
   return CreateIntegerWithU64(static_cast<uint64_t>(value), false);
 }
@@ -168,14 +196,36 @@ int64_t ToI64(const Integer& integer) {
   if (integer.IsZero()) {
     return 0;
   }
-  if (integer.Data().Size() > 4) {
+  if (IsBigNumber(integer)) {
     throw std::runtime_error("Integer is too large to be converted to index");
   }
-  int64_t result = 0;
-  for (Index i = 0; i < integer.Data().Size(); i++) {
-    result = (result << Integer::radix) | integer.Data().Get(i);
-  }
+  auto result = static_cast<int64_t>(Magnitude64(integer.Data()));
   return integer.Sign() ? -result : result;
 }
+bool TryToI64(const Integer& integer, int64_t& result) {
+  if (integer.IsZero()) {
+    result = 0;
+    return true;
+  }
+  if (IsBigNumber(integer)) {
+    return false;
+  }
+  const uint64_t magnitude = Magnitude64(integer.Data());
+  constexpr auto limit =
+    static_cast<uint64_t>(std::numeric_limits<int64_t>::max());
+  if (!integer.Sign()) {
+    if (magnitude > limit) {
+      return false;
+    }
+    result = static_cast<int64_t>(magnitude);
+    return true;
+  }
+  if (magnitude > limit + 1) {
+    return false;
+  }
+  result = magnitude == limit + 1 ? std::numeric_limits<int64_t>::min()
+                                  : -static_cast<int64_t>(magnitude);
+  return true;
+}
 
 }  // namespace kaubo::Collections
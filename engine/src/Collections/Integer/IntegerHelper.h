@@ -6,9 +6,12 @@ namespace kaubo::Collections {
 int8_t ByteToHex(Byte byte) noexcept;
 Byte HexToByte(uint8_t hex) noexcept;
 Integer CreateIntegerWithDecimal(const Decimal& decimal);
-void TrimLeadingZero(List<uint32_t>& parts);
-void TrimTrailingZero(List<uint32_t>& parts);
-Integer Slice(const Integer& integer, Index start, Index end);
+/** @brief 去掉高位的零段 */
+void TrimHighZeros(IntegerParts& parts);
+/** @brief 原地计算 parts * multiplier + addend */
+void MultiplyAdd(IntegerParts& parts, uint32_t multiplier, uint32_t addend);
+/** @brief 原地除以 divisor，返回余数 */
+uint32_t DivideSmall(IntegerParts& parts, uint32_t divisor);
 Integer CreateIntegerWithString(const String& str);
 Integer CreateIntegerWithCString(const char* str);
 Integer CreateIntegerZero();
@@ -19,4 +22,5 @@ Integer CreateIntegerWithI64(int64_t value);
 uint64_t ToU64(const Integer& integer);
 bool IsBigNumber(const Integer& integer);
 int64_t ToI64(const Integer& integer);
+bool TryToI64(const Integer& integer, int64_t& result);
 }  // namespace kaubo::Collections
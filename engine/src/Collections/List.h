@@ -2,33 +2,84 @@
 #include "Common.h"
 
 #include <algorithm>
+#include <cstdlib>
+#include <cstring>
 #include <initializer_list>
 #include <memory>
+#include <new>
 #include <random>
 #include <stdexcept>
+#include <type_traits>
 namespace kaubo::Collections {
 const Index INIT_CAPACITY = 10;
+namespace Detail {
+/**
+ * @brief List 的内联存储，元素不超过 N 个时不向堆申请内存
+ */
+template <typename T, Index N>
+struct InlineStorage {
+  T* InlineData() noexcept { return inlineElements; }
+  const T* InlineData() const noexcept { return inlineElements; }
+  T inlineElements[N]{};
+};
+// N 为 0 时作为空基类，不增加 List 的大小
 template <typename T>
-class List {
+struct InlineStorage<T, 0> {
+  T* InlineData() noexcept { return nullptr; }
+  const T* InlineData() const noexcept { return nullptr; }
+};
+}  // namespace Detail
+/**
+ * @brief 动态数组
+ * @details 容量不超过 N 时元素存放在对象内部，超过后转到堆上；
+ * N 默认为 0，即总是使用堆。平凡类型的堆存储用 calloc/realloc 管理，
+ * 扩容时可以原地增长，其余类型用 new[] 分配并移动元素。
+ * [0, capacity) 范围内的槽位始终是已构造的对象，size 之后的槽位为值初始化
+ * 或被移走后的状态
+ */
+template <typename T, Index N = 0>
+class List : private Detail::InlineStorage<T, N> {
+  template <typename U, Index M>
+  friend class List;
+
  private:
+  static constexpr bool TRIVIAL = std::is_trivial_v<T>;
   /**
    * 当前列表中元素的个数
    */
   Index size;
   /**
    * 列表的容量，即列表中最多可以存放的元素个数
-   * 内存分配时，会分配capacity个元素的空间
+   * 使用内联存储时容量不超过 N
    */
   Index capacity;
   /**
-   * 列表中的元素
+   * 列表中的元素，指向内联存储或堆上的数组
    */
-  std::unique_ptr<T[]> elements;
+  T* elements;
   /**
    * @brief 扩容
-   * @details 默认扩容为原来的两倍
+   * @details 第一次扩容先用满内联存储，之后扩容为原来的 1.5 倍
    */
   void Expand();
+  /**
+   * @brief 把存储调整为 newCapacity 个元素，保留前 size 个元素
+   */
+  void Reallocate(Index newCapacity);
+  [[nodiscard]] bool OnHeap() const noexcept {
+    return elements != nullptr && elements != this->InlineData();
+  }
+  static T* Allocate(Index count);
+  static void Free(T* pointer) noexcept;
+  /**
+   * @brief 从另一个列表接管元素，堆上的存储直接转移，内联的元素逐个移动
+   * @details 内联容量相同时不会申请内存；对方内联的元素比本列表的内联容量
+   * 多时要先申请堆存储，可能抛出 std::bad_alloc，此时对方的元素保持不动
+   */
+  template <Index M>
+  void Steal(List<T, M>& other);
+  template <Index M>
+  void Assign(const List<T, M>& other);
 
  public:
   void Expand(Index newCapacity);
@@ -37,20 +88,25 @@ class List {
   explicit List();
   explicit List(Index count, T element);
   List(std::initializer_list<T> list);
-  explicit List(Index count, std::unique_ptr<T[]> data)
-    : size(count), capacity(count), elements(std::move(data)) {}
+  explicit List(Index count, std::unique_ptr<T[]> data);
   explicit List(Index count, T* stream)
-    : size(count), capacity(count), elements(std::make_unique<T[]>(count)) {
-    std::copy(stream, stream + count, elements.get());
-  }
-  explicit List(Index count, const T* stream)
-    : size(count), capacity(count), elements(std::make_unique<T[]>(count)) {
-    std::copy(stream, stream + count, elements.get());
-  }
-  List(const List<T>& other);
-  List(List<T>&& other) noexcept;
-  List<T>& operator=(const List<T>& other);
-  List<T>& operator=(List<T>&& other) noexcept;
+    : List(count, static_cast<const T*>(stream)) {}
+  explicit List(Index count, const T* stream);
+  List(const List<T, N>& other);
+  List(List<T, N>&& other) noexcept;
+  /**
+   * @brief 从内联容量不同的列表复制或接管元素
+   */
+  template <Index M>
+  List(const List<T, M>& other);
+  template <Index M>
+  List(List<T, M>&& other);
+  List<T, N>& operator=(const List<T, N>& other);
+  List<T, N>& operator=(List<T, N>&& other) noexcept;
+  template <Index M>
+  List<T, N>& operator=(const List<T, M>& other);
+  template <Index M>
+  List<T, N>& operator=(List<T, M>&& other);
   /**
    * 析构函数
    */
@@ -65,8 +121,14 @@ class List {
    * @return 容量
    */
   [[nodiscard]] Index Capacity() const;
+  /**
+   * 获取列表在堆上占用的字节数，用于内存统计；内联存储计入对象本身
+   */
+  [[nodiscard]] Index HeapBytes() const {
+    return OnHeap() ? capacity * sizeof(T) : 0;
+  }
   T* Data();
-  const T* Data() const { return elements.get(); }
+  const T* Data() const { return elements; }
   /**
    * @brief 返回列表末尾的元素
    * @return 第一个元素
@@ -89,11 +151,13 @@ class List {
   T Last() const;
   /**
    * @brief 在列表末端添加元素
+   * @details 元素按值传入后移动到槽位中，传入右值时不发生复制
    * @param element 要添加的元素
    */
   void Push(T element);
   /**
    * @brief 移除列表末尾的元素
+   * @details 元素被移出，槽位不再持有它
    * @return 被移除的元素
    */
   T Pop();
@@ -102,19 +166,19 @@ class List {
    * @param k 要移除的元素个数
    * @return 被移除的元素组成的列表
    */
-  List<T> Pop(Index k);
+  List<T, N> Pop(Index k);
   /**
    * @brief 合并列表
    * @details 本身列表不会改变，返回一个新的列表
    * @param list 要合并的列表
    * @return 合并后的新列表
    */
-  List<T> Add(const List<T>& list);
+  List<T, N> Add(const List<T, N>& list);
   /**
    * @brief 将新的列表拷贝添加到列表末尾
    * @param list 要添加的列表
    */
-  void Concat(const List<T>& list);
+  void Concat(const List<T, N>& list);
   /**
    * @brief 清空列表
    */
@@ -125,7 +189,7 @@ class List {
    * @param end 切片的结束索引（不包含）
    * @return 列表在 [start, end) 之间的元素组成的列表
    */
-  [[nodiscard]] List<T> Slice(Index start, Index end) const;
+  [[nodiscard]] List<T, N> Slice(Index start, Index end) const;
   /**
    * @brief 移除指定位置的元素
    * @param index 要移除的元素的索引
@@ -143,7 +207,7 @@ class List {
    * @param end 要插入的元素
    * @param list 要插入的元素列表
    */
-  void InsertAndReplace(Index start, Index end, const List<T>& list);
+  void InsertAndReplace(Index start, Index end, const List<T, N>& list);
   /**
    * @brief 在指定位置插入元素
    * @param index 要插入的位置
@@ -200,224 +264,340 @@ class List {
    * @brief 浅拷贝当前列表
    * @return 浅拷贝后的列表
    */
-  [[nodiscard]] List<T> Copy() const;
+  [[nodiscard]] List<T, N> Copy() const;
 
   void Shuffle();
 };
-template <typename T>
-List<T>::~List() = default;
-template <typename T>
-List<T>::List(Index _capacity) : size(0), capacity(_capacity) {
-  if (_capacity > 0) {
-    elements = std::make_unique<T[]>(_capacity);
+template <typename T, Index N>
+T* List<T, N>::Allocate(Index count) {
+  if constexpr (TRIVIAL) {
+    auto* pointer = static_cast<T*>(std::calloc(count, sizeof(T)));
+    if (pointer == nullptr) {
+      throw std::bad_alloc();
+    }
+    return pointer;
+  } else {
+    return new T[count]();
+  }
+}
+template <typename T, Index N>
+void List<T, N>::Free(T* pointer) noexcept {
+  if constexpr (TRIVIAL) {
+    std::free(pointer);
+  } else {
+    delete[] pointer;
+  }
+}
+template <typename T, Index N>
+void List<T, N>::Reallocate(Index newCapacity) {
+  if (newCapacity <= N) {
+    // 元素放得进内联存储，堆上的元素搬回来
+    if (OnHeap()) {
+      std::move(elements, elements + size, this->InlineData());
+      Free(elements);
+      elements = this->InlineData();
+    }
+    capacity = newCapacity;
+    return;
   }
-}
-template <typename T>
-List<T>::List() : size(0), capacity(0), elements(nullptr) {}
-template <typename T>
-List<T>::List(Index count, T element) : size(count) {
-  if (count == 0) {
-    throw std::runtime_error("List::List: count is 0");
+  if constexpr (TRIVIAL) {
+    if (OnHeap()) {
+      auto* grown =
+        static_cast<T*>(std::realloc(elements, newCapacity * sizeof(T)));
+      if (grown == nullptr) {
+        throw std::bad_alloc();
+      }
+      if (newCapacity > capacity) {
+        std::memset(
+          grown + capacity, 0, (newCapacity - capacity) * sizeof(T)
+        );
+      }
+      elements = grown;
+      capacity = newCapacity;
+      return;
+    }
+  }
+  T* newElements = Allocate(newCapacity);
+  std::move(elements, elements + size, newElements);
+  if (OnHeap()) {
+    Free(elements);
   }
-  capacity = count;
-  elements = std::make_unique<T[]>(count);
-  std::fill(elements.get(), elements.get() + count, element);
+  elements = newElements;
+  capacity = newCapacity;
 }
-template <typename T>
-List<T>::List(std::initializer_list<T> list)
-  : size(list.size()),
-    capacity(list.size()),
-    elements(std::make_unique<T[]>(list.size())) {
-  std::copy(list.begin(), list.end(), elements.get());
+template <typename T, Index N>
+template <Index M>
+void List<T, N>::Steal(List<T, M>& other) {
+  if (other.OnHeap() && other.capacity > N) {
+    elements = other.elements;
+    capacity = other.capacity;
+    size = other.size;
+  } else {
+    // 调用方保证此时本列表使用内联存储或为空
+    Reallocate(std::max(other.size, capacity));
+    std::move(other.elements, other.elements + other.size, elements);
+    size = other.size;
+    if (other.OnHeap()) {
+      Free(other.elements);
+    }
+  }
+  other.elements = other.InlineData();
+  other.capacity = 0;
+  other.size = 0;
 }
-template <typename T>
-List<T>::List(const List<T>& other) : size(other.size), capacity(other.size) {
-  if (size == 0) {
-    return;
+template <typename T, Index N>
+List<T, N>::~List() {
+  if (OnHeap()) {
+    Free(elements);
   }
-  elements = std::make_unique<T[]>(size);
-  std::copy(other.elements.get(), other.elements.get() + size, elements.get());
 }
-template <typename T>
-List<T>::List(List<T>&& other) noexcept
-  : size(other.size),
-    capacity(other.capacity),
-    elements(std::move(other.elements)) {
-  other.size = 0;
-  other.capacity = 0;
+template <typename T, Index N>
+List<T, N>::List(Index _capacity)
+  : size(0), capacity(0), elements(this->InlineData()) {
+  if (_capacity > 0) {
+    Reallocate(_capacity);
+  }
 }
-template <typename T>
-List<T>& List<T>::operator=(List<T>&& other) noexcept {
+template <typename T, Index N>
+List<T, N>::List() : size(0), capacity(0), elements(this->InlineData()) {}
+template <typename T, Index N>
+List<T, N>::List(Index count, T element) : List(count) {
+  if (count == 0) {
+    throw std::runtime_error("List::List: count is 0");
+  }
+  std::fill(elements, elements + count, element);
+  size = count;
+}
+template <typename T, Index N>
+List<T, N>::List(std::initializer_list<T> list) : List(list.size()) {
+  std::copy(list.begin(), list.end(), elements);
+  size = list.size();
+}
+template <typename T, Index N>
+List<T, N>::List(Index count, std::unique_ptr<T[]> data) : List(count) {
+  std::move(data.get(), data.get() + count, elements);
+  size = count;
+}
+template <typename T, Index N>
+List<T, N>::List(Index count, const T* stream) : List(count) {
+  std::copy(stream, stream + count, elements);
+  size = count;
+}
+template <typename T, Index N>
+List<T, N>::List(const List<T, N>& other) : List(other.size) {
+  std::copy(other.elements, other.elements + other.size, elements);
+  size = other.size;
+}
+template <typename T, Index N>
+List<T, N>::List(List<T, N>&& other) noexcept
+  : size(0), capacity(0), elements(this->InlineData()) {
+  Steal(other);
+}
+template <typename T, Index N>
+template <Index M>
+List<T, N>::List(const List<T, M>& other) : List(other.size) {
+  std::copy(other.elements, other.elements + other.size, elements);
+  size = other.size;
+}
+template <typename T, Index N>
+template <Index M>
+List<T, N>::List(List<T, M>&& other)
+  : size(0), capacity(0), elements(this->InlineData()) {
+  Steal(other);
+}
+template <typename T, Index N>
+List<T, N>& List<T, N>::operator=(List<T, N>&& other) noexcept {
   if (this != &other) {
-    size = other.size;
-    capacity = other.capacity;
-    elements = std::move(other.elements);
-    other.size = 0;
-    other.capacity = 0;
+    Clear();
+    if (OnHeap()) {
+      Free(elements);
+    }
+    elements = this->InlineData();
+    capacity = 0;
+    Steal(other);
   }
   return *this;
 }
-template <typename T>
-List<T>& List<T>::operator=(const List<T>& other) {
+template <typename T, Index N>
+template <Index M>
+List<T, N>& List<T, N>::operator=(List<T, M>&& other) {
+  Clear();
+  if (OnHeap()) {
+    Free(elements);
+  }
+  elements = this->InlineData();
+  capacity = 0;
+  Steal(other);
+  return *this;
+}
+template <typename T, Index N>
+List<T, N>& List<T, N>::operator=(const List<T, N>& other) {
   if (this != &other) {
-    size = other.size;
-    capacity = other.capacity;
-    elements = std::make_unique<T[]>(other.capacity);
-    std::copy(
-      other.elements.get(), other.elements.get() + size, elements.get()
-    );
+    Assign(other);
   }
   return *this;
 }
-template <typename T>
-Index List<T>::Size() const {
+template <typename T, Index N>
+template <Index M>
+List<T, N>& List<T, N>::operator=(const List<T, M>& other) {
+  Assign(other);
+  return *this;
+}
+template <typename T, Index N>
+template <Index M>
+void List<T, N>::Assign(const List<T, M>& other) {
+  Clear();
+  if (other.size > capacity) {
+    Reallocate(other.size);
+  }
+  std::copy(other.elements, other.elements + other.size, elements);
+  size = other.size;
+}
+template <typename T, Index N>
+Index List<T, N>::Size() const {
   return size;
 }
-template <typename T>
-Index List<T>::Capacity() const {
+template <typename T, Index N>
+Index List<T, N>::Capacity() const {
   return capacity;
 }
-template <typename T>
-T List<T>::First() const {
+template <typename T, Index N>
+T List<T, N>::First() const {
   if (Empty()) {
     throw std::runtime_error("List::First: List is empty");
   }
   return elements[0];
 }
-template <typename T>
-T List<T>::Shift() {
+template <typename T, Index N>
+T List<T, N>::Shift() {
   if (Empty()) {
     throw std::runtime_error("List::Shift: List is empty");
   }
   T element = std::move(elements[0]);
-  std::move(elements.get() + 1, elements.get() + size, elements.get());
+  std::move(elements + 1, elements + size, elements);
   size--;
+  elements[size] = T();
   return element;
 }
-template <typename T>
-void List<T>::Unshift(T element) {
+template <typename T, Index N>
+void List<T, N>::Unshift(T element) {
   if (Full()) {
     Expand();
   }
-  std::move(elements.get(), elements.get() + size, elements.get() + 1);
-  elements[0] = element;
+  std::move_backward(elements, elements + size, elements + size + 1);
+  elements[0] = std::move(element);
   size++;
 }
-template <typename T>
-T List<T>::Last() const {
+template <typename T, Index N>
+T List<T, N>::Last() const {
   if (Empty()) {
     throw std::runtime_error("List::Last: List is empty");
   }
   return elements[size - 1];
 }
-template <typename T>
-void List<T>::Push(T element) {
+template <typename T, Index N>
+void List<T, N>::Push(T element) {
   if (Full()) {
     Expand();
   }
-  elements[size] = element;
+  elements[size] = std::move(element);
   size++;
 }
-template <typename T>
-T List<T>::Pop() {
+template <typename T, Index N>
+T List<T, N>::Pop() {
   if (Empty()) {
     throw std::runtime_error("List::Pop: List is empty");
   }
   size--;
-  return elements[size];
+  return std::move(elements[size]);
 }
-template <typename T>
-List<T> List<T>::Pop(Index k) {
+template <typename T, Index N>
+List<T, N> List<T, N>::Pop(Index k) {
   if (k > size) {
     throw std::runtime_error("List::Pop: k is greater than size");
   }
   if (k == 0) {
-    return List<T>();
+    return List<T, N>();
   }
-  List<T> list(k);
-  std::copy(
-    elements.get() + size - k, elements.get() + size, list.elements.get()
-  );
+  List<T, N> list(k);
+  std::move(elements + size - k, elements + size, list.elements);
   list.size = k;
   size -= k;
   return list;
 }
-template <typename T>
-List<T> List<T>::Add(const List<T>& list) {
-  List<T> newList(size + list.size);
-  std::copy(elements.get(), elements.get() + size, newList.elements.get());
-  std::copy(
-    list.elements.get(), list.elements.get() + list.size,
-    newList.elements.get() + size
-  );
+template <typename T, Index N>
+List<T, N> List<T, N>::Add(const List<T, N>& list) {
+  List<T, N> newList(size + list.size);
+  std::copy(elements, elements + size, newList.elements);
+  std::copy(list.elements, list.elements + list.size, newList.elements + size);
   newList.size = size + list.size;
   return newList;
 }
-template <typename T>
-void List<T>::Concat(const List<T>& list) {
+template <typename T, Index N>
+void List<T, N>::Concat(const List<T, N>& list) {
   if (size + list.size > capacity) {
     Expand(size + list.size);
   }
-  std::copy(
-    list.elements.get(), list.elements.get() + list.size, elements.get() + size
-  );
+  std::copy(list.elements, list.elements + list.size, elements + size);
   size += list.size;
 }
-template <typename T>
-void List<T>::Clear() {
+template <typename T, Index N>
+void List<T, N>::Clear() {
+  if constexpr (!TRIVIAL) {
+    // 放下槽位里的元素，引用计数的对象随之释放
+    std::fill(elements, elements + size, T());
+  }
   size = 0;
 }
-template <typename T>
-List<T> List<T>::Slice(Index start, Index end) const {
+template <typename T, Index N>
+List<T, N> List<T, N>::Slice(Index start, Index end) const {
   if (start >= size || end > size || start >= end) {
     throw std::runtime_error("List::Slice::Index out of range");
   }
-  List<T> list(end - start);
-  std::copy(elements.get() + start, elements.get() + end, list.elements.get());
+  List<T, N> list(end - start);
+  std::copy(elements + start, elements + end, list.elements);
   list.size = end - start;
   return list;
 }
-template <typename T>
-void List<T>::Insert(Index index, T element) {
+template <typename T, Index N>
+void List<T, N>::Insert(Index index, T element) {
   if (index > size) {
     throw std::runtime_error("List::Insert::Index out of range");
   }
   if (Full()) {
     Expand();
   }
-  auto rawElements = elements.get();
-  std::copy_backward(
-    rawElements + index, rawElements + size, rawElements + size + 1
-  );
-  elements[index] = element;
+  std::move_backward(elements + index, elements + size, elements + size + 1);
+  elements[index] = std::move(element);
   size++;
 }
-template <typename T>
-void List<T>::RemoveAt(Index index) {
+template <typename T, Index N>
+void List<T, N>::RemoveAt(Index index) {
   if (!ValidIndex(index)) {
     throw std::runtime_error("List::RemoveAt::Index out of range");
   }
-  std::move(
-    elements.get() + index + 1, elements.get() + size, elements.get() + index
-  );
+  std::move(elements + index + 1, elements + size, elements + index);
   size--;
+  elements[size] = T();
 }
-template <typename T>
-void List<T>::RemoveRange(Index start, Index length) {
+template <typename T, Index N>
+void List<T, N>::RemoveRange(Index start, Index length) {
   if (start >= size || start + length > size) {
     throw std::runtime_error("List::RemoveRange::Index out of range");
   }
   if (length == 0) {
     return;
   }
-  std::move(
-    elements.get() + start + length, elements.get() + size,
-    elements.get() + start
-  );
+  std::move(elements + start + length, elements + size, elements + start);
+  std::fill(elements + size - length, elements + size, T());
   size -= length;
 }
-template <typename T>
-void List<T>::InsertAndReplace(Index start, Index end, const List<T>& list) {
+template <typename T, Index N>
+void List<T, N>::InsertAndReplace(
+  Index start,
+  Index end,
+  const List<T, N>& list
+) {
   // 检查索引是否越界
   if (start > size || end > size || start > end) {
     throw std::runtime_error("List::InsertAndReplace::Index out of range");
@@ -430,15 +610,9 @@ void List<T>::InsertAndReplace(Index start, Index end, const List<T>& list) {
   if (insertLength < removeLength) {
     // 将 [end, size-1] 的元素移动到 [start + insertLength, size - removeLength
     // + insertLength - 1]
-    std::move(
-      elements.get() + end, elements.get() + size,
-      elements.get() + start + insertLength
-    );
+    std::move(elements + end, elements + size, elements + start + insertLength);
     // 将 list 的元素复制到 [start, start + insertLength - 1]
-    std::copy(
-      list.elements.get(), list.elements.get() + insertLength,
-      elements.get() + start
-    );
+    std::copy(list.elements, list.elements + insertLength, elements + start);
     // 更新列表大小
     size = size - removeLength + insertLength;
   }
@@ -452,70 +626,56 @@ void List<T>::InsertAndReplace(Index start, Index end, const List<T>& list) {
     }
     // 将 [end, size-1] 的元素移动到 [start + insertLength, size + insertLength
     // - removeLength - 1]
-    std::move(
-      elements.get() + end, elements.get() + size,
-      elements.get() + start + insertLength
+    std::move_backward(
+      elements + end, elements + size,
+      elements + size + insertLength - removeLength
     );
     // 将 list 的元素复制到 [start, start + insertLength - 1]
-    std::copy(
-      list.elements.get(), list.elements.get() + insertLength,
-      elements.get() + start
-    );
+    std::copy(list.elements, list.elements + insertLength, elements + start);
     // 更新列表大小
     size += insertLength - removeLength;
   }
   // 如果插入的元素个数等于移除的元素个数
   else {
     // 直接将 list 的元素复制到 [start, start + insertLength - 1]
-    std::copy(
-      list.elements.get(), list.elements.get() + insertLength,
-      elements.get() + start
-    );
+    std::copy(list.elements, list.elements + insertLength, elements + start);
   }
 }
-template <typename T>
-void List<T>::Reverse() {
+template <typename T, Index N>
+void List<T, N>::Reverse() {
   if (size <= 1) {
     return;
   }
-  std::reverse(elements.get(), elements.get() + size);
+  std::reverse(elements, elements + size);
 }
-template <typename T>
-void List<T>::TrimExcess() {
-  if (size == 0) {
-    capacity = 0;
-    elements.reset();
-    return;
-  }
+template <typename T, Index N>
+void List<T, N>::TrimExcess() {
   if (size == capacity) {
     return;
   }
-  std::unique_ptr<T[]> newElements = std::make_unique<T[]>(size);
-  std::copy(elements.get(), elements.get() + size, newElements.get());
-  elements = std::move(newElements);
-  capacity = size;
+  Reallocate(size);
 }
-template <typename T>
-bool List<T>::Empty() const noexcept {
+template <typename T, Index N>
+bool List<T, N>::Empty() const noexcept {
   return size == 0;
 }
-template <typename T>
-bool List<T>::ValidIndex(Index index) const noexcept {
+template <typename T, Index N>
+bool List<T, N>::ValidIndex(Index index) const noexcept {
   return size > 0 && index < size;
 }
-template <typename T>
-bool List<T>::Full() const noexcept {
+template <typename T, Index N>
+bool List<T, N>::Full() const noexcept {
   return size >= capacity;
 }
-template <typename T>
-T List<T>::Get(Index index) const {
+template <typename T, Index N>
+T List<T, N>::Get(Index index) const {
   if (!ValidIndex(index)) {
     throw std::out_of_range("List::Get: Index out of range");
   }
   return elements[index];
 }
-template <typename T>
-bool List<T>::Contains(T element) const {
+template <typename T, Index N>
+bool List<T, N>::Contains(T element) const {
   for (Index i = 0; i < size; i++) {
     if (elements[i] == element) {
       return true;
@@ -523,8 +683,8 @@ bool List<T>::Contains(T element) const {
   }
   return false;
 }
-template <typename T>
-Index List<T>::IndexOf(T element) const {
+template <typename T, Index N>
+Index List<T, N>::IndexOf(T element) const {
   for (Index i = 0; i < size; i++) {
     if (elements[i] == element) {
       return i;
@@ -532,76 +692,66 @@ Index List<T>::IndexOf(T element) const {
   }
   throw std::runtime_error("List::IndexOf: Element not found");
 }
-template <typename T>
-T& List<T>::operator[](Index index) {
+template <typename T, Index N>
+T& List<T, N>::operator[](Index index) {
   if (!ValidIndex(index)) {
     throw std::out_of_range("List::operator[]: Index out of range");
   }
   return elements[index];
 }
-template <typename T>
-const T& List<T>::operator[](Index index) const {
+template <typename T, Index N>
+const T& List<T, N>::operator[](Index index) const {
   if (!ValidIndex(index)) {
     throw std::out_of_range("List::const operator[]: Index out of range");
   }
   return elements[index];
 }
-template <typename T>
-void List<T>::Set(Index index, T element) {
+template <typename T, Index N>
+void List<T, N>::Set(Index index, T element) {
   if (!ValidIndex(index)) {
     throw std::runtime_error("List::Set::Index out of range");
   }
-  elements[index] = element;
+  elements[index] = std::move(element);
 }
-template <typename T>
-void List<T>::Expand() {
-  Index newCapacity = std::max(capacity + (capacity >> 1), INIT_CAPACITY);
-  std::unique_ptr<T[]> newElements = std::make_unique<T[]>(newCapacity);
-  std::copy(elements.get(), elements.get() + size, newElements.get());
-  elements = std::move(newElements);
-  capacity = newCapacity;
+template <typename T, Index N>
+void List<T, N>::Expand() {
+  Index newCapacity = capacity < N
+                        ? N
+                        : std::max(capacity + (capacity >> 1), INIT_CAPACITY);
+  Reallocate(newCapacity);
 }
-template <typename T>
-void List<T>::Expand(Index newCapacity) {
-  std::unique_ptr<T[]> newElements = std::make_unique<T[]>(newCapacity);
-  std::copy(elements.get(), elements.get() + size, newElements.get());
-  elements = std::move(newElements);
-  capacity = newCapacity;
+template <typename T, Index N>
+void List<T, N>::Expand(Index newCapacity) {
+  Reallocate(newCapacity);
 }
-template <typename T>
-void List<T>::ExpandWithElement(Index newCapacity, T element) {
-  std::unique_ptr<T[]> newElements = std::make_unique<T[]>(newCapacity);
-  std::fill(newElements.get(), newElements.get() + newCapacity, element);
-  std::copy(elements.get(), elements.get() + size, newElements.get());
-  elements = std::move(newElements);
-  capacity = newCapacity;
+template <typename T, Index N>
+void List<T, N>::ExpandWithElement(Index newCapacity, T element) {
+  Reallocate(newCapacity);
+  std::fill(elements + size, elements + newCapacity, element);
   size = newCapacity;
 }
-template <typename T>
-void List<T>::Fill(T element) {
+template <typename T, Index N>
+void List<T, N>::Fill(T element) {
   if (capacity == 0) {
     throw std::runtime_error("List::Fill: List is empty");
   }
-  std::fill(elements.get(), elements.get() + capacity, element);
+  std::fill(elements, elements + capacity, element);
   size = capacity;
 }
-template <typename T>
-List<T> List<T>::Copy() const {
-  List<T> newList(size);
-  std::copy(elements.get(), elements.get() + size, newList.elements.get());
-  newList.size = size;
-  return newList;
+template <typename T, Index N>
+List<T, N> List<T, N>::Copy() const {
+  return List<T, N>(*this);
 }
-template <typename T>
-T* List<T>::Data() {
-  return elements.get();
+template <typename T, Index N>
+T* List<T, N>::Data() {
+  return elements;
 }
 
-template <typename T>
-void List<T>::Shuffle() {
+template <typename T, Index N>
+void List<T, N>::Shuffle() {
   std::random_device randomDevice;
   std::mt19937 gen(randomDevice());
-  std::shuffle(elements.get(), elements.get() + size, gen);
+  std::shuffle(elements, elements + size, gen);
 }
 
-}  // namespace kaubo::Collections
\ No newline at end of file
+}  // namespace kaubo::Collections
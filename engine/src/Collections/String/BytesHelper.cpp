@@ -12,6 +12,9 @@
 #include <stdexcept>
 
 namespace kaubo::Collections {
+namespace {
+constexpr uint32_t HalfLimbBits = Integer::limbBits / 2;
+}  // namespace
 String ReprByte(Byte byte) {
   // 使用 \x 格式表示一个字节
   std::ostringstream oss;
@@ -103,16 +106,19 @@ String Serialize(const Integer& value) {
   if (value.IsZero()) {
     return CreateStringWithCString("");
   }
-  Index size = value.Data().Size();
+  // 字节码里仍按 16 位一块、高位块在前存放，与内存中的分段宽度无关
+  const auto& data = value.Data();
+  Index size = data.Size() * 2;
+  if ((data.Last() >> HalfLimbBits) == 0) {
+    size--;
+  }
   List<Byte> bytes((size * 2) + sizeof(uint64_t) + 1);
   StringBuilder result(String(std::move(bytes)));
   result.Append(Serialize(size));
   result.Append(value.Sign() ? '-' : '+');
-  auto data = value.Data();
-  for (Index i = 0; i < size; i++) {
-    result.Append(
-      Serialize(static_cast<uint16_t>(data.Get(i) & Integer::low16Mask))
-    );
+  for (Index i = size; i-- > 0;) {
+    const uint32_t shift = (i % 2) * HalfLimbBits;
+    result.Append(Serialize(static_cast<uint16_t>(data.Get(i / 2) >> shift)));
   }
   return result.ToString();
 }
@@ -135,12 +141,17 @@ Integer DeserializeInteger(const List<Byte>& bytes) {
       throw std::runtime_error("Invalid sign for Integer");
   }
   iter++;
-  List<uint32_t> data;
+  if (size == 0) {
+    return CreateIntegerZero();
+  }
+  IntegerParts data((size + 1) / 2, 0U);
   for (Index j = 0; j < size; j++) {
-    data.Push(DeserializeU16(bytes.Slice(
+    const uint32_t chunk = DeserializeU16(bytes.Slice(
       iter + (j * sizeof(uint16_t)), iter + ((j + 1) * sizeof(uint16_t))
-    )));
+    ));
+    const Index position = size - 1 - j;
+    data[position / 2] |= chunk << ((position % 2) * HalfLimbBits);
   }
-  return Integer(data, sign);
+  return Integer(std::move(data), sign);
 }
 }  // namespace kaubo::Collections
\ No newline at end of file
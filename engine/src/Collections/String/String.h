@@ -149,6 +149,11 @@ class String {
   }
   size_t HashValue() const;
   String Upper();
+  /// @brief 码元和懒计算的码点缓存在堆上占用的字节数
+  [[nodiscard]] Index HeapBytes() const {
+    return codeUnits.HeapBytes() + codePoints.HeapBytes() +
+           codePointIndices.HeapBytes();
+  }
 };
 
 class StringBuilder {
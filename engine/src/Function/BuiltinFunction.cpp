@@ -1,5 +1,6 @@
 #include "Function/BuiltinFunction.h"
 #include "Collections/Integer/IntegerHelper.h"
+#include "Object/Container/PyDictionary.h"
 #include "Object/Container/PyList.h"
 #include "Object/Core/PyBoolean.h"
 #include "Object/Core/PyNone.h"
@@ -13,6 +14,9 @@
 #include "Object/Number/PyInteger.h"
 #include "Object/Object.h"
 #include "Object/String/PyString.h"
+#include "Runtime/GarbageCollector.h"
+#include "Runtime/MemoryStats.h"
+#include "Runtime/ObjectPool.h"
 #include "Runtime/VirtualMachine.h"
 #include "Tools/Terminal/Terminal.h"
 
@@ -25,12 +29,15 @@
 
 namespace kaubo::Function {
 
-Object::PyObjPtr Identity(const Object::PyObjPtr& args) {
-  CheckNativeFunctionArgumentsWithExpectedLength(args, 1);
-  auto obj = args->as<Object::PyList>()->GetItem(0);
+Object::PyObjPtr Identity(
+  const Object::PyObjPtr& /*self*/,
+  const Object::PyObjPtr* args,
+  Index nargs
+) {
+  Object::CheckNativeFunctionArgumentCount(nargs, 1);
+  const auto address = reinterpret_cast<uint64_t>(args[0].get());
   return Object::PyString::Create(
-    Collections::CreateIntegerWithU64(reinterpret_cast<uint64_t>(obj.get()))
-      .ToHexString()
+    Collections::CreateIntegerWithU64(address).ToHexString()
   );
 }
 
@@ -47,38 +54,50 @@ void DebugPrint(const Object::PyObjPtr& obj) {
   }
 }
 
-Object::PyObjPtr Print(const Object::PyObjPtr& args) {
-  CheckNativeFunctionArguments(args);
-  auto argList = args->as<Object::PyList>();
-  if (argList->Length() == 0) {
+Object::PyObjPtr Print(
+  const Object::PyObjPtr& /*self*/,
+  const Object::PyObjPtr* args,
+  Index nargs
+) {
+  if (nargs == 0) {
     return Object::PyNone::Create();
   }
   std::string result =
-    argList->GetItem(0)->str()->as<Object::PyString>()->ToCppString();
-  for (Index i = 1; i < argList->Length(); i++) {
+    args[0]->str()->as<Object::PyString>()->ToCppString();
+  for (Index i = 1; i < nargs; i++) {
     result += " ";
-    auto arg = argList->GetItem(i);
-    result += arg->str()->as<Object::PyString>()->ToCppString();
+    result += args[i]->str()->as<Object::PyString>()->ToCppString();
   }
   ConsoleTerminal::get_instance().info(result);
   return Object::PyNone::Create();
 }
 
-Object::PyObjPtr Len(const Object::PyObjPtr& args) {
-  CheckNativeFunctionArgumentsWithExpectedLength(args, 1);
-  return args->as<Object::PyList>()->GetItem(0)->len();
+Object::PyObjPtr Len(
+  const Object::PyObjPtr& /*self*/,
+  const Object::PyObjPtr* args,
+  Index nargs
+) {
+  Object::CheckNativeFunctionArgumentCount(nargs, 1);
+  return args[0]->len();
 }
 
-Object::PyObjPtr Next(const Object::PyObjPtr& args) {
-  CheckNativeFunctionArgumentsWithExpectedLength(args, 1);
-  return args->as<Object::PyList>()->GetItem(0)->next();
+Object::PyObjPtr Next(
+  const Object::PyObjPtr& /*self*/,
+  const Object::PyObjPtr* args,
+  Index nargs
+) {
+  Object::CheckNativeFunctionArgumentCount(nargs, 1);
+  return args[0]->next();
 }
 
-Object::PyObjPtr RandInt(const Object::PyObjPtr& args) {
-  CheckNativeFunctionArgumentsWithExpectedLength(args, 2);
-  auto argList = args->as<Object::PyList>();
-  auto left = argList->GetItem(0)->as<Object::PyInteger>();
-  auto right = argList->GetItem(1)->as<Object::PyInteger>();
+Object::PyObjPtr RandInt(
+  const Object::PyObjPtr& /*self*/,
+  const Object::PyObjPtr* args,
+  Index nargs
+) {
+  Object::CheckNativeFunctionArgumentCount(nargs, 2);
+  auto left = args[0]->as<Object::PyInteger>();
+  auto right = args[1]->as<Object::PyInteger>();
   if (IsTrue(left->ge(
         Object::PyInteger::Create(
           static_cast<uint64_t>(std::numeric_limits<int32_t>::max())
@@ -108,10 +127,13 @@ Object::PyObjPtr RandInt(const Object::PyObjPtr& args) {
   return Object::PyInteger::Create(static_cast<int64_t>(result));
 }
 
-Object::PyObjPtr Sleep(const Object::PyObjPtr& args) {
-  CheckNativeFunctionArgumentsWithExpectedLength(args, 1);
-  auto seconds =
-    args->as<Object::PyList>()->GetItem(0)->as<Object::PyInteger>();
+Object::PyObjPtr Sleep(
+  const Object::PyObjPtr& /*self*/,
+  const Object::PyObjPtr* args,
+  Index nargs
+) {
+  Object::CheckNativeFunctionArgumentCount(nargs, 1);
+  auto seconds = args[0]->as<Object::PyInteger>();
   if (IsTrue(seconds->lt(Object::PyInteger::Create(0ULL)))) {
     seconds->str()->as<Object::PyString>()->Print();
     throw std::runtime_error("Sleep function need non-negative argument");
@@ -120,20 +142,23 @@ Object::PyObjPtr Sleep(const Object::PyObjPtr& args) {
   std::this_thread::sleep_for(std::chrono::seconds(secondsValue));
   return Object::PyNone::Create();
 }
-Object::PyObjPtr Normal(const Object::PyObjPtr& args) {
-  CheckNativeFunctionArgumentsWithExpectedLength(args, 3);
-  auto argList = args->as<Object::PyList>();
-  auto loc = argList->GetItem(0)->as<Object::PyFloat>()->Value();
-  auto scale = argList->GetItem(1)->as<Object::PyFloat>()->Value();
+Object::PyObjPtr Normal(
+  const Object::PyObjPtr& /*self*/,
+  const Object::PyObjPtr* args,
+  Index nargs
+) {
+  Object::CheckNativeFunctionArgumentCount(nargs, 3);
+  auto loc = args[0]->as<Object::PyFloat>()->Value();
+  auto scale = args[1]->as<Object::PyFloat>()->Value();
   std::random_device randomDevice;
   std::mt19937 gen(randomDevice());
   std::normal_distribution<> dis(loc, scale);
-  auto size = argList->GetItem(2);
+  const auto& size = args[2];
   if (size->is(Object::IntegerKlass::Self())) {
     auto sizeValue = size->as<Object::PyInteger>()->ToU64();
     auto result = Object::PyList::Create(Object::PyList::ExpandOnly{sizeValue});
     for (Index i = 0; i < sizeValue; i++) {
-      result->SetItem(i, Object::PyFloat::Create(dis(gen)));
+      result->Append(Object::PyFloat::Create(dis(gen)));
     }
     return result;
   }
@@ -151,10 +176,13 @@ Object::PyObjPtr Normal(const Object::PyObjPtr& args) {
   throw std::runtime_error("Normal function need integer or list argument");
 }
 
-Object::PyObjPtr Shuffle(const Object::PyObjPtr& args) {
-  CheckNativeFunctionArgumentsWithExpectedLength(args, 1);
-  auto argList = args->as<Object::PyList>();
-  auto arg = argList->GetItem(0);
+Object::PyObjPtr Shuffle(
+  const Object::PyObjPtr& /*self*/,
+  const Object::PyObjPtr* args,
+  Index nargs
+) {
+  Object::CheckNativeFunctionArgumentCount(nargs, 1);
+  const auto& arg = args[0];
   if (arg->is(Object::ListKlass::Self())) {
     arg->as<Object::PyList>()->Shuffle();
     return Object::PyNone::Create();
@@ -166,13 +194,13 @@ Object::PyObjPtr Shuffle(const Object::PyObjPtr& args) {
   throw std::runtime_error("Shuffle function need list or matrix argument");
 }
 
-Object::PyObjPtr Input(const Object::PyObjPtr& args) {
-  CheckNativeFunctionArguments(args);
-  if (args->as<Object::PyList>()->Length() > 0) {
-    auto prompt = args->as<Object::PyList>()
-                    ->GetItem(0)
-                    ->as<Object::PyString>()
-                    ->ToCppString();
+Object::PyObjPtr Input(
+  const Object::PyObjPtr& /*self*/,
+  const Object::PyObjPtr* args,
+  Index nargs
+) {
+  if (nargs > 0) {
+    auto prompt = args[0]->as<Object::PyString>()->ToCppString();
     ConsoleTerminal::get_instance().info(prompt);
   }
   return Object::CreatePyPromise(
@@ -214,14 +242,17 @@ Object::PyObjPtr Input(const Object::PyObjPtr& args) {
   );
 }
 
-auto ReadFile(const Object::PyObjPtr& args) noexcept -> Object::PyObjPtr {
-  CheckNativeFunctionArgumentsWithExpectedLength(args, 1);
-  auto argList = args->as<Object::PyList>();
-  auto filePath = argList->GetItem(0)->as<Object::PyString>()->ToCppString();
+auto ReadFile(
+  const Object::PyObjPtr& /*self*/,
+  const Object::PyObjPtr* args,
+  Index nargs
+) noexcept -> Object::PyObjPtr {
+  Object::CheckNativeFunctionArgumentCount(nargs, 1);
+  auto filePath = args[0]->as<Object::PyString>()->ToCppString();
   return Object::CreatePyPromise(
-    Object::PyNativeFunction::Create([filePath](const Object::PyObjPtr& args) {
-      auto resolve = args->as<Object::PyList>()->GetItem(0);
-      auto reject = args->as<Object::PyList>()->GetItem(1);
+    Object::PyNativeFunction::Create([filePath](const Object::PyObjPtr& list) {
+      auto resolve = list->as<Object::PyList>()->GetItem(0);
+      auto reject = list->as<Object::PyList>()->GetItem(1);
       try {
         std::ifstream file(filePath);
         if (!file.is_open()) {
@@ -295,13 +326,21 @@ auto ReadFile(const Object::PyObjPtr& args) noexcept -> Object::PyObjPtr {
 //   return Object::CreatePyPromise(executor);
 // }
 
-Object::PyObjPtr Iter(const Object::PyObjPtr& args) {
-  CheckNativeFunctionArgumentsWithExpectedLength(args, 1);
-  return args->as<Object::PyList>()->GetItem(0)->iter();
+Object::PyObjPtr Iter(
+  const Object::PyObjPtr& /*self*/,
+  const Object::PyObjPtr* args,
+  Index nargs
+) {
+  Object::CheckNativeFunctionArgumentCount(nargs, 1);
+  return args[0]->iter();
 }
 
-Object::PyObjPtr Time(const Object::PyObjPtr& args) {
-  CheckNativeFunctionArgumentsWithExpectedLength(args, 0);
+Object::PyObjPtr Time(
+  const Object::PyObjPtr& /*self*/,
+  const Object::PyObjPtr* /*args*/,
+  Index nargs
+) {
+  Object::CheckNativeFunctionArgumentCount(nargs, 0);
   auto now = std::chrono::system_clock::now();
 
   // 分解时间点为秒和纳秒部分
@@ -346,20 +385,23 @@ else:
         yield start
         start += step
  * */
-Object::PyObjPtr Range(const Object::PyObjPtr& args) {
-  auto argList = args->as<Object::PyList>();
+Object::PyObjPtr Range(
+  const Object::PyObjPtr& /*self*/,
+  const Object::PyObjPtr* args,
+  Index nargs
+) {
   int64_t start = 0;
   int64_t end = 0;
   int64_t step = 1;
-  if (argList->Length() == 1) {
-    end = argList->GetItem(0)->as<Object::PyInteger>()->ToI64();
-  } else if (argList->Length() == 2) {
-    start = argList->GetItem(0)->as<Object::PyInteger>()->ToI64();
-    end = argList->GetItem(1)->as<Object::PyInteger>()->ToI64();
-  } else if (argList->Length() == 3) {
-    start = argList->GetItem(0)->as<Object::PyInteger>()->ToI64();
-    end = argList->GetItem(1)->as<Object::PyInteger>()->ToI64();
-    step = argList->GetItem(2)->as<Object::PyInteger>()->ToI64();
+  if (nargs == 1) {
+    end = args[0]->as<Object::PyInteger>()->ToI64();
+  } else if (nargs == 2) {
+    start = args[0]->as<Object::PyInteger>()->ToI64();
+    end = args[1]->as<Object::PyInteger>()->ToI64();
+  } else if (nargs == 3) {
+    start = args[0]->as<Object::PyInteger>()->ToI64();
+    end = args[1]->as<Object::PyInteger>()->ToI64();
+    step = args[2]->as<Object::PyInteger>()->ToI64();
   }
   if (step == 0) {
     throw std::runtime_error("Step cannot be zero");
@@ -389,18 +431,25 @@ Object::PyObjPtr Range(const Object::PyObjPtr& args) {
   );
 }
 
-Object::PyObjPtr Type(const Object::PyObjPtr& args) {
-  CheckNativeFunctionArgumentsWithExpectedLength(args, 1);
-  auto obj = args->getitem(Object::PyInteger::Create(0ULL));
-  return obj->Klass()->Type();
+Object::PyObjPtr Type(
+  const Object::PyObjPtr& /*self*/,
+  const Object::PyObjPtr* args,
+  Index nargs
+) {
+  Object::CheckNativeFunctionArgumentCount(nargs, 1);
+  return args[0]->Klass()->Type();
 }
 
-Object::PyObjPtr BuildClass(const Object::PyObjPtr& args) {
-  auto argList = args->as<Object::PyList>();
+Object::PyObjPtr BuildClass(
+  const Object::PyObjPtr& /*self*/,
+  const Object::PyObjPtr* args,
+  Index nargs
+) {
+  Object::CheckNativeFunctionArgumentCount(nargs, 3);
   // 解析参数：函数、类名和基类
-  auto function = argList->GetItem(0)->as<Object::PyFunction>();
-  auto name = argList->GetItem(1);
-  auto bases = argList->GetItem(2)->as<Object::PyList>();
+  auto function = args[0]->as<Object::PyFunction>();
+  const auto& name = args[1];
+  auto bases = args[2]->as<Object::PyList>();
 
   // 创建执行环境
   auto globals = function->Globals();
@@ -429,9 +478,13 @@ Object::PyObjPtr BuildClass(const Object::PyObjPtr& args) {
   return type;
 }
 
-auto LogisticLoss(const Object::PyObjPtr& args) noexcept -> Object::PyObjPtr {
-  auto argList = args->as<Object::PyList>();
-  auto matrix = argList->GetItem(0)->as<Object::PyMatrix>();
+auto LogisticLoss(
+  const Object::PyObjPtr& /*self*/,
+  const Object::PyObjPtr* args,
+  Index nargs
+) noexcept -> Object::PyObjPtr {
+  Object::CheckNativeFunctionArgumentCount(nargs, 1);
+  auto matrix = args[0]->as<Object::PyMatrix>();
   const Collections::List<double>& values = matrix->Ravel();
   Collections::List<double> result(values.Size(), static_cast<double>(0));
   for (Index i = 0; i < values.Size(); i++) {
@@ -446,10 +499,13 @@ auto LogisticLoss(const Object::PyObjPtr& args) noexcept -> Object::PyObjPtr {
   );
 }
 
-auto LogisticLossDerivative(const Object::PyObjPtr& args) noexcept
-  -> Object::PyObjPtr {
-  auto argList = args->as<Object::PyList>();
-  auto matrix = argList->GetItem(0)->as<Object::PyMatrix>();
+auto LogisticLossDerivative(
+  const Object::PyObjPtr& /*self*/,
+  const Object::PyObjPtr* args,
+  Index nargs
+) noexcept -> Object::PyObjPtr {
+  Object::CheckNativeFunctionArgumentCount(nargs, 1);
+  auto matrix = args[0]->as<Object::PyMatrix>();
   const Collections::List<double>& values = matrix->Ravel();
   Collections::List<double> result(values.Size(), static_cast<double>(0));
   for (Index i = 0; i < values.Size(); i++) {
@@ -464,9 +520,13 @@ auto LogisticLossDerivative(const Object::PyObjPtr& args) noexcept
   );
 }
 
-auto Sum(const Object::PyObjPtr& args) noexcept -> Object::PyObjPtr {
-  auto argList = args->as<Object::PyList>();
-  auto matrix = argList->GetItem(0)->as<Object::PyMatrix>();
+auto Sum(
+  const Object::PyObjPtr& /*self*/,
+  const Object::PyObjPtr* args,
+  Index nargs
+) noexcept -> Object::PyObjPtr {
+  Object::CheckNativeFunctionArgumentCount(nargs, 1);
+  auto matrix = args[0]->as<Object::PyMatrix>();
   const Collections::List<double>& values = matrix->Ravel();
   double result = 0;
   for (Index i = 0; i < values.Size(); i++) {
@@ -475,9 +535,13 @@ auto Sum(const Object::PyObjPtr& args) noexcept -> Object::PyObjPtr {
   return Object::PyFloat::Create(result);
 }
 
-auto Log(const Object::PyObjPtr& args) noexcept -> Object::PyObjPtr {
-  auto argList = args->as<Object::PyList>();
-  auto matrix = argList->GetItem(0)->as<Object::PyMatrix>();
+auto Log(
+  const Object::PyObjPtr& /*self*/,
+  const Object::PyObjPtr* args,
+  Index nargs
+) noexcept -> Object::PyObjPtr {
+  Object::CheckNativeFunctionArgumentCount(nargs, 1);
+  auto matrix = args[0]->as<Object::PyMatrix>();
   const Collections::List<double>& values = matrix->Ravel();
   Collections::List<double> result(values.Size(), static_cast<double>(0));
   for (Index i = 0; i < values.Size(); i++) {
@@ -489,9 +553,13 @@ auto Log(const Object::PyObjPtr& args) noexcept -> Object::PyObjPtr {
   );
 }
 
-auto SoftMax(const Object::PyObjPtr& args) noexcept -> Object::PyObjPtr {
-  auto argList = args->as<Object::PyList>();
-  auto matrix = argList->GetItem(0)->as<Object::PyMatrix>();
+auto SoftMax(
+  const Object::PyObjPtr& /*self*/,
+  const Object::PyObjPtr* args,
+  Index nargs
+) noexcept -> Object::PyObjPtr {
+  Object::CheckNativeFunctionArgumentCount(nargs, 1);
+  auto matrix = args[0]->as<Object::PyMatrix>();
   const Collections::List<double>& values = matrix->Ravel();
   Collections::List<double> result(values.Size(), static_cast<double>(0));
   double sum = 0;
@@ -508,9 +576,13 @@ auto SoftMax(const Object::PyObjPtr& args) noexcept -> Object::PyObjPtr {
   );
 }
 
-auto Max(const Object::PyObjPtr& args) noexcept -> Object::PyObjPtr {
-  auto argList = args->as<Object::PyList>();
-  auto matrix = argList->GetItem(0)->as<Object::PyMatrix>();
+auto Max(
+  const Object::PyObjPtr& /*self*/,
+  const Object::PyObjPtr* args,
+  Index nargs
+) noexcept -> Object::PyObjPtr {
+  Object::CheckNativeFunctionArgumentCount(nargs, 1);
+  auto matrix = args[0]->as<Object::PyMatrix>();
   const Collections::List<double>& values = matrix->Ravel();
   double maxValue = values[0];
   for (Index i = 1; i < values.Size(); i++) {
@@ -519,9 +591,13 @@ auto Max(const Object::PyObjPtr& args) noexcept -> Object::PyObjPtr {
   return Object::PyFloat::Create(maxValue);
 }
 
-auto ArgMax(const Object::PyObjPtr& args) noexcept -> Object::PyObjPtr {
-  auto argList = args->as<Object::PyList>();
-  auto matrix = argList->GetItem(0)->as<Object::PyMatrix>();
+auto ArgMax(
+  const Object::PyObjPtr& /*self*/,
+  const Object::PyObjPtr* args,
+  Index nargs
+) noexcept -> Object::PyObjPtr {
+  Object::CheckNativeFunctionArgumentCount(nargs, 1);
+  auto matrix = args[0]->as<Object::PyMatrix>();
   const Collections::List<double>& values = matrix->Ravel();
   double maxValue = values[0];
   Index maxIndex = 0;
@@ -534,10 +610,164 @@ auto ArgMax(const Object::PyObjPtr& args) noexcept -> Object::PyObjPtr {
   return Object::PyInteger::Create(maxIndex);
 }
 
-auto Hash(const Object::PyObjPtr& args) noexcept -> Object::PyObjPtr {
-  auto argList = args->as<Object::PyList>();
-  auto arg = argList->GetItem(0);
-  return arg->hash();
+auto Hash(
+  const Object::PyObjPtr& /*self*/,
+  const Object::PyObjPtr* args,
+  Index nargs
+) noexcept -> Object::PyObjPtr {
+  Object::CheckNativeFunctionArgumentCount(nargs, 1);
+  return args[0]->hash();
+}
+
+Object::PyObjPtr GcCollect(
+  const Object::PyObjPtr& /*self*/,
+  const Object::PyObjPtr* args,
+  Index nargs
+) {
+  auto generation = Runtime::GarbageCollector::GENERATIONS - 1;
+  if (nargs > 1) {
+    throw std::runtime_error("gcCollect(): too many arguments");
+  }
+  if (nargs == 1) {
+    generation = args[0]->as<Object::PyInteger>()->ToU64();
+  }
+  return Object::PyInteger::Create(
+    Runtime::GarbageCollector::Instance().Collect(generation)
+  );
+}
+
+Object::PyObjPtr GcStats(
+  const Object::PyObjPtr& /*self*/,
+  const Object::PyObjPtr* /*args*/,
+  Index nargs
+) {
+  Object::CheckNativeFunctionArgumentCount(nargs, 0);
+  auto stats = Runtime::GarbageCollector::Instance().GetStats();
+  auto collections = Object::PyList::Create();
+  auto tracked = Object::PyList::Create();
+  for (Index i = 0; i < Runtime::GarbageCollector::GENERATIONS; i++) {
+    collections->Append(Object::PyInteger::Create(stats.collections[i]));
+    tracked->Append(Object::PyInteger::Create(stats.tracked[i]));
+  }
+  auto result = Object::PyDictionary::Create();
+  result->Put(Object::PyString::Create("collections"), collections);
+  result->Put(Object::PyString::Create("tracked"), tracked);
+  result->Put(
+    Object::PyString::Create("collected"),
+    Object::PyInteger::Create(stats.collected)
+  );
+  return result;
+}
+
+Object::PyObjPtr MemStats(
+  const Object::PyObjPtr& /*self*/,
+  const Object::PyObjPtr* /*args*/,
+  Index nargs
+) {
+  Object::CheckNativeFunctionArgumentCount(nargs, 0);
+  // 先汇总再创建结果对象，结果本身不计入统计
+  auto entries = Runtime::MemoryStats::Collect();
+  auto result = Object::PyDictionary::Create();
+  for (Index i = 0; i < entries.Size(); i++) {
+    const auto& entry = entries[i];
+    if (entry.klass == nullptr || entry.klass->Name() == nullptr) {
+      continue;
+    }
+    auto name = entry.klass->Name();
+    auto objects = entry.objects;
+    auto bytes = entry.bytes;
+    // 同名的 Klass（例如不同作用域里的同名类）合并到一项
+    auto existing = result->TryGet(name);
+    if (existing != nullptr) {
+      auto stats = existing->as<Object::PyDictionary>();
+      objects += stats->Get(Object::PyString::Create("objects"))
+                   ->as<Object::PyInteger>()
+                   ->ToU64();
+      bytes += stats->Get(Object::PyString::Create("bytes"))
+                 ->as<Object::PyInteger>()
+                 ->ToU64();
+    }
+    auto stats = Object::PyDictionary::Create();
+    stats->Put(
+      Object::PyString::Create("objects"), Object::PyInteger::Create(objects)
+    );
+    stats->Put(
+      Object::PyString::Create("bytes"), Object::PyInteger::Create(bytes)
+    );
+    result->Put(name, stats);
+  }
+  return result;
+}
+
+Object::PyObjPtr PoolStats(
+  const Object::PyObjPtr& /*self*/,
+  const Object::PyObjPtr* /*args*/,
+  Index nargs
+) {
+  Object::CheckNativeFunctionArgumentCount(nargs, 0);
+  // 先复制计数再创建结果对象，结果本身的分配不计入
+  Index live = 0;
+  Index pooled = 0;
+  Index highWater = 0;
+  for (const auto& counters : Runtime::ObjectPool::SizeClassCounters()) {
+    live += counters.live;
+    pooled += counters.pooled;
+    highWater += counters.highWater;
+  }
+  const auto& registered = Runtime::ObjectPool::Types();
+  Collections::List<Runtime::ObjectPool::TypeCounters> snapshot(
+    registered.Size()
+  );
+  for (Index i = 0; i < registered.Size(); i++) {
+    snapshot.Push(*registered[i]);
+  }
+  auto types = Object::PyDictionary::Create();
+  for (Index i = 0; i < snapshot.Size(); i++) {
+    const auto& counters = snapshot[i];
+    auto* klass = counters.klass();
+    if (klass == nullptr || klass->Name() == nullptr) {
+      continue;
+    }
+    auto name = klass->Name();
+    auto typeLive = counters.live;
+    auto typeHighWater = counters.highWater;
+    // 共用一个 Klass 的不同 C++ 类型合并到一项
+    auto existing = types->TryGet(name);
+    if (existing != nullptr) {
+      auto stats = existing->as<Object::PyDictionary>();
+      typeLive += stats->Get(Object::PyString::Create("live"))
+                    ->as<Object::PyInteger>()
+                    ->ToU64();
+      typeHighWater += stats->Get(Object::PyString::Create("highWater"))
+                         ->as<Object::PyInteger>()
+                         ->ToU64();
+    }
+    auto stats = Object::PyDictionary::Create();
+    stats->Put(
+      Object::PyString::Create("live"), Object::PyInteger::Create(typeLive)
+    );
+    stats->Put(
+      Object::PyString::Create("highWater"),
+      Object::PyInteger::Create(typeHighWater)
+    );
+    types->Put(name, stats);
+  }
+  auto result = Object::PyDictionary::Create();
+  result->Put(
+    Object::PyString::Create("enabled"),
+    Object::PyBoolean::Create(Runtime::ObjectPool::ENABLED)
+  );
+  result->Put(
+    Object::PyString::Create("live"), Object::PyInteger::Create(live)
+  );
+  result->Put(
+    Object::PyString::Create("pooled"), Object::PyInteger::Create(pooled)
+  );
+  result->Put(
+    Object::PyString::Create("highWater"), Object::PyInteger::Create(highWater)
+  );
+  result->Put(Object::PyString::Create("types"), types);
+  return result;
 }
 
 }  // namespace kaubo::Function
\ No newline at end of file
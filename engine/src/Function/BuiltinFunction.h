@@ -4,30 +4,160 @@
 #include "Object/Object.h"
 
 namespace kaubo::Function {
-Object::PyObjPtr Identity(const Object::PyObjPtr& args);
-Object::PyObjPtr RandInt(const Object::PyObjPtr& args);
-Object::PyObjPtr Sleep(const Object::PyObjPtr& args);
-Object::PyObjPtr Input(const Object::PyObjPtr& args);
-auto ReadFile(const Object::PyObjPtr& args) noexcept -> Object::PyObjPtr;
+// 内置函数采用向量调用约定，见 Object::VectorFunction
+Object::PyObjPtr Identity(
+  const Object::PyObjPtr& self,
+  const Object::PyObjPtr* args,
+  Index nargs
+);
+Object::PyObjPtr RandInt(
+  const Object::PyObjPtr& self,
+  const Object::PyObjPtr* args,
+  Index nargs
+);
+Object::PyObjPtr Sleep(
+  const Object::PyObjPtr& self,
+  const Object::PyObjPtr* args,
+  Index nargs
+);
+Object::PyObjPtr Input(
+  const Object::PyObjPtr& self,
+  const Object::PyObjPtr* args,
+  Index nargs
+);
+auto ReadFile(
+  const Object::PyObjPtr& self,
+  const Object::PyObjPtr* args,
+  Index nargs
+) noexcept -> Object::PyObjPtr;
 // auto Coroutine(const Object::PyObjPtr& args) noexcept -> Object::PyObjPtr;
-Object::PyObjPtr Normal(const Object::PyObjPtr& args);
-Object::PyObjPtr Shuffle(const Object::PyObjPtr& args);
+Object::PyObjPtr Normal(
+  const Object::PyObjPtr& self,
+  const Object::PyObjPtr* args,
+  Index nargs
+);
+Object::PyObjPtr Shuffle(
+  const Object::PyObjPtr& self,
+  const Object::PyObjPtr* args,
+  Index nargs
+);
 void DebugPrint(const Object::PyObjPtr& obj);
-Object::PyObjPtr Print(const Object::PyObjPtr& args);
-Object::PyObjPtr Len(const Object::PyObjPtr& args);
-Object::PyObjPtr Next(const Object::PyObjPtr& args);
-Object::PyObjPtr Iter(const Object::PyObjPtr& args);
-Object::PyObjPtr Time(const Object::PyObjPtr& args);
-Object::PyObjPtr Range(const Object::PyObjPtr& args);
-Object::PyObjPtr Type(const Object::PyObjPtr& args);
-Object::PyObjPtr BuildClass(const Object::PyObjPtr& args);
-auto LogisticLoss(const Object::PyObjPtr& args) noexcept -> Object::PyObjPtr;
-auto LogisticLossDerivative(const Object::PyObjPtr& args) noexcept
-  -> Object::PyObjPtr;
-auto Sum(const Object::PyObjPtr& args) noexcept -> Object::PyObjPtr;
-auto Log(const Object::PyObjPtr& args) noexcept -> Object::PyObjPtr;
-auto SoftMax(const Object::PyObjPtr& args) noexcept -> Object::PyObjPtr;
-auto Max(const Object::PyObjPtr& args) noexcept -> Object::PyObjPtr;
-auto ArgMax(const Object::PyObjPtr& args) noexcept -> Object::PyObjPtr;
-auto Hash(const Object::PyObjPtr& args) noexcept -> Object::PyObjPtr;
+Object::PyObjPtr Print(
+  const Object::PyObjPtr& self,
+  const Object::PyObjPtr* args,
+  Index nargs
+);
+Object::PyObjPtr Len(
+  const Object::PyObjPtr& self,
+  const Object::PyObjPtr* args,
+  Index nargs
+);
+Object::PyObjPtr Next(
+  const Object::PyObjPtr& self,
+  const Object::PyObjPtr* args,
+  Index nargs
+);
+Object::PyObjPtr Iter(
+  const Object::PyObjPtr& self,
+  const Object::PyObjPtr* args,
+  Index nargs
+);
+Object::PyObjPtr Time(
+  const Object::PyObjPtr& self,
+  const Object::PyObjPtr* args,
+  Index nargs
+);
+Object::PyObjPtr Range(
+  const Object::PyObjPtr& self,
+  const Object::PyObjPtr* args,
+  Index nargs
+);
+Object::PyObjPtr Type(
+  const Object::PyObjPtr& self,
+  const Object::PyObjPtr* args,
+  Index nargs
+);
+Object::PyObjPtr BuildClass(
+  const Object::PyObjPtr& self,
+  const Object::PyObjPtr* args,
+  Index nargs
+);
+auto LogisticLoss(
+  const Object::PyObjPtr& self,
+  const Object::PyObjPtr* args,
+  Index nargs
+) noexcept -> Object::PyObjPtr;
+auto LogisticLossDerivative(
+  const Object::PyObjPtr& self,
+  const Object::PyObjPtr* args,
+  Index nargs
+) noexcept -> Object::PyObjPtr;
+auto Sum(
+  const Object::PyObjPtr& self,
+  const Object::PyObjPtr* args,
+  Index nargs
+) noexcept -> Object::PyObjPtr;
+auto Log(
+  const Object::PyObjPtr& self,
+  const Object::PyObjPtr* args,
+  Index nargs
+) noexcept -> Object::PyObjPtr;
+auto SoftMax(
+  const Object::PyObjPtr& self,
+  const Object::PyObjPtr* args,
+  Index nargs
+) noexcept -> Object::PyObjPtr;
+auto Max(
+  const Object::PyObjPtr& self,
+  const Object::PyObjPtr* args,
+  Index nargs
+) noexcept -> Object::PyObjPtr;
+auto ArgMax(
+  const Object::PyObjPtr& self,
+  const Object::PyObjPtr* args,
+  Index nargs
+) noexcept -> Object::PyObjPtr;
+auto Hash(
+  const Object::PyObjPtr& self,
+  const Object::PyObjPtr* args,
+  Index nargs
+) noexcept -> Object::PyObjPtr;
+/**
+ * @brief gcCollect([generation])：回收引用环，返回回收的容器数
+ */
+Object::PyObjPtr GcCollect(
+  const Object::PyObjPtr& self,
+  const Object::PyObjPtr* args,
+  Index nargs
+);
+/**
+ * @brief gcStats()：垃圾回收器的统计，键为 collections、tracked 和 collected
+ */
+Object::PyObjPtr GcStats(
+  const Object::PyObjPtr& self,
+  const Object::PyObjPtr* args,
+  Index nargs
+);
+/**
+ * @brief memstats()：按类型名汇总的存活对象数和字节数
+ * @details 值是键为 objects 和 bytes 的字典；
+ * 编译时未打开 KAUBO_MEMORY_STATS 时返回空字典
+ */
+Object::PyObjPtr MemStats(
+  const Object::PyObjPtr& self,
+  const Object::PyObjPtr* args,
+  Index nargs
+);
+/**
+ * @brief poolStats()：当前线程对象池的计数
+ * @details 键为 enabled、live、pooled、highWater 和 types：live 和 pooled
+ * 是各尺寸级已分配和空闲待复用的块数之和，highWater 是各尺寸级峰值之和；
+ * types 按类型名给出键为 live 和 highWater 的字典。
+ * 编译时关闭 KAUBO_OBJECT_POOL 时 enabled 为 False，其余各项为 0 或空
+ */
+Object::PyObjPtr PoolStats(
+  const Object::PyObjPtr& self,
+  const Object::PyObjPtr* args,
+  Index nargs
+);
 }  // namespace kaubo::Function
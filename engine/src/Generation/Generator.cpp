@@ -35,6 +35,7 @@ namespace kaubo::Generation {
 
 Generator::Generator(const Object::PyStrPtr& filename)
   : codeList(Object::PyList::Create()) {
+  arena.Activate();
   context = IR::CreateModule(Object::PyList::Create(), filename);
 }
 
@@ -50,8 +51,11 @@ void Generator::Print() {
   context->print();
 }
 
-[[nodiscard]] Object::PyCodePtr Generator::Code() const {
-  return IR::GetCodeFromList(codeList, context);
+[[nodiscard]] Object::PyCodePtr Generator::Code() {
+  auto code = IR::GetCodeFromList(codeList, context);
+  arena.Release();
+  context = nullptr;
+  return code;
 }
 
 antlrcpp::Any Generator::visitStmt(Python3Parser::StmtContext* ctx) {
@@ -656,7 +660,7 @@ antlrcpp::Any Generator::visitFuncdef(Python3Parser::FuncdefContext* ctx) {
   auto body = std::any_cast<Object::PyListPtr>(visitBlock(ctx->block()));
   funcDef->SetBody(body);
   context = oldContext;  // 恢复上下文
-  return std::dynamic_pointer_cast<IR::INode>(funcDef);
+  return Object::DynamicRefCast<IR::INode>(funcDef);
 }
 
 antlrcpp::Any Generator::visitBlock(Python3Parser::BlockContext* ctx) {
@@ -873,7 +877,7 @@ antlrcpp::Any Generator::visitClassdef(Python3Parser::ClassdefContext* ctx) {
   auto body = std::any_cast<Object::PyListPtr>(visitBlock(ctx->block()));
   classDef->SetBody(body);
   context = oldContext;
-  return std::dynamic_pointer_cast<IR::INode>(classDef);
+  return Object::DynamicRefCast<IR::INode>(classDef);
 }
 
 antlrcpp::Any
@@ -15,6 +15,7 @@ namespace kaubo::Generation {
 
 class Generator : public Python3ParserBaseVisitor {
  private:
+  IR::NodeArena arena;  // 最先构造、最后析构，结点都析构后才释放内存
   Object::PyListPtr codeList;
   IR::INodePtr context;
 
@@ -23,7 +24,10 @@ class Generator : public Python3ParserBaseVisitor {
   void Visit();
   void Emit();
   void Print();
-  [[nodiscard]] Object::PyCodePtr Code() const;
+  /**
+   * @brief 取出模块的字节码，随后释放整棵 IR 树，之后不能再访问 IR
+   */
+  [[nodiscard]] Object::PyCodePtr Code();
   antlrcpp::Any visitFile_input(Python3Parser::File_inputContext* ctx) override;
   antlrcpp::Any visitAtom(Python3Parser::AtomContext* ctx) override;
   antlrcpp::Any visitExpr(Python3Parser::ExprContext* ctx) override;
@@ -28,6 +28,8 @@ class AssignStmtKlass : public INodeTrait,
 
 class AssignStmt : public INode {
  public:
+  using KlassType = AssignStmtKlass;
+
   explicit AssignStmt(INodePtr target, INodePtr source, const INodePtr& parent)
     : INode(AssignStmtKlass::Self(), parent),
       target(std::move(target)),
@@ -44,7 +46,7 @@ class AssignStmt : public INode {
 
 inline INodePtr
 CreateAssignStmt(INodePtr target, INodePtr source, INodePtr parent) {
-  return std::make_shared<AssignStmt>(
+  return Object::MakeRef<AssignStmt>(
     std::move(target), std::move(source), std::move(parent)
   );
 }
@@ -76,6 +76,8 @@ Object::PyObjPtr ClassDefKlass::emit(
   });
   selfCode->LoadConst(Object::PyNone::Create());
   selfCode->ReturnValue();
+  selfCode->FuseSuperInstructions();
+  selfCode->ComputeStackSize();
   auto parent = GetCodeFromList(codeList, classDef->Parent());
   parent->LoadBuildClass();
   parent->LoadConst(selfCode);
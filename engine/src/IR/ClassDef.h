@@ -27,6 +27,8 @@ class ClassDefKlass : public INodeTrait,
 
 class ClassDef : public INode {
  public:
+  using KlassType = ClassDefKlass;
+
   explicit ClassDef(
     Object::PyStrPtr name,
     INodePtr bases,
@@ -47,6 +49,12 @@ class ClassDef : public INode {
 
   void SetBody(const Object::PyListPtr& new_body) { body = new_body; }
 
+ protected:
+  void ReleaseReferences() noexcept override {
+    INode::ReleaseReferences();
+    parents = nullptr;
+  }
+
  private:
   Object::PyStrPtr name;   // 类名
   Object::PyListPtr body;  // 类的主体
@@ -61,7 +69,7 @@ inline INodePtr CreateClassDef(
   const INodePtr& bases,
   const INodePtr& parent
 ) {
-  return std::make_shared<ClassDef>(name, bases, parent);
+  return Object::MakeRef<ClassDef>(name, bases, parent);
 }
 
 }  // namespace kaubo::IR
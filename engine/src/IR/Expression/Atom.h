@@ -28,6 +28,8 @@ class AtomKlass : public INodeTrait, public Object::KlassBase<AtomKlass> {
 // True False None Integer Float String字面量，不包含dict, list, tuple
 class Atom : public INode {
  public:
+  using KlassType = AtomKlass;
+
   explicit Atom(Object::PyObjPtr obj, const INodePtr& parent)
     : INode(AtomKlass::Self(), parent), obj(std::move(obj)) {}
 
@@ -38,7 +40,7 @@ class Atom : public INode {
 };
 
 inline INodePtr CreateAtom(Object::PyObjPtr obj, INodePtr parent) {
-  return std::make_shared<Atom>(std::move(obj), std::move(parent));
+  return Object::MakeRef<Atom>(std::move(obj), std::move(parent));
 }
 
 }  // namespace kaubo::IR
@@ -28,6 +28,8 @@ class BinaryKlass : public INodeTrait, public Object::KlassBase<BinaryKlass> {
 
 class Binary : public IR::INode {
  public:
+  using KlassType = BinaryKlass;
+
   enum class Operator : uint8_t {
     IN_OP,         // in
     LT,            // <
@@ -82,7 +84,7 @@ inline INodePtr CreateBinary(
   const INodePtr& right,
   const INodePtr& parent
 ) {
-  return std::make_shared<Binary>(oprt, left, right, parent);
+  return Object::MakeRef<Binary>(oprt, left, right, parent);
 }
 
 inline Object::PyStrPtr Stringify(Binary::Operator oprt) {
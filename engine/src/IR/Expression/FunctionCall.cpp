@@ -1,4 +1,5 @@
 #include "IR/Expression/FunctionCall.h"
+#include "IR/MemberAccess.h"
 #include "Object/Core/PyNone.h"
 #include "Object/Iterator/IteratorHelper.h"
 namespace kaubo::IR {
@@ -10,12 +11,24 @@ Object::PyObjPtr FunctionCallKlass::emit(
   auto functionCall = obj->as<FunctionCall>();
   auto func = functionCall->Func();
   auto args = functionCall->Args();
-  func->emit(codeList);
+  auto code = GetCodeFromList(codeList, functionCall);
+  // obj.method(...) 直接取出方法和 self，不创建绑定方法对象
+  const bool isMethodCall = func->is(MemberAccessKlass::Self());
+  if (isMethodCall) {
+    auto memberAccess = func->as<MemberAccess>();
+    memberAccess->Obj()->emit(codeList);
+    code->LoadMethod(memberAccess->Member());
+  } else {
+    func->emit(codeList);
+  }
   Object::ForEach(args, [&codeList](const Object::PyObjPtr& arg) {
     arg->as<INode>()->emit(codeList);
   });
-  auto code = GetCodeFromList(codeList, functionCall);
-  code->CallFunction(args->Length());
+  if (isMethodCall) {
+    code->CallMethod(args->Length());
+  } else {
+    code->CallFunction(args->Length());
+  }
   return Object::PyNone::Create();
 }
 
@@ -28,6 +28,8 @@ class FunctionCallKlass : public INodeTrait,
 
 class FunctionCall : public INode {
  public:
+  using KlassType = FunctionCallKlass;
+
   FunctionCall(INodePtr func, Object::PyListPtr args, INodePtr parent)
     : INode(FunctionCallKlass::Self(), std::move(parent)),
       func(std::move(func)),
@@ -42,14 +44,14 @@ class FunctionCall : public INode {
   Object::PyListPtr args;
 };
 
-using FunctionCallPtr = std::shared_ptr<FunctionCall>;
+using FunctionCallPtr = Object::Ref<FunctionCall>;
 
 inline INodePtr CreateFunctionCall(
   const INodePtr& func,
   const Object::PyListPtr& args,
   const INodePtr& parent
 ) {
-  return std::make_shared<FunctionCall>(func, args, parent);
+  return Object::MakeRef<FunctionCall>(func, args, parent);
 }
 
 }  // namespace kaubo::IR
@@ -31,6 +31,8 @@ class ListKlass : public INodeTrait, public Object::KlassBase<ListKlass> {
 // 作为右值的list
 class List : public INode {
  public:
+  using KlassType = ListKlass;
+
   explicit List(Object::PyListPtr elements, INodePtr parent)
     : INode(ListKlass::Self(), std::move(parent)),
       elements(std::move(elements)) {}
@@ -41,11 +43,11 @@ class List : public INode {
   Object::PyListPtr elements;
 };
 
-using ListPtr = std::shared_ptr<List>;
+using ListPtr = Object::Ref<List>;
 
 inline INodePtr
 CreateList(const Object::PyListPtr& elements, const INodePtr& parent) {
-  return std::make_shared<List>(elements, parent);
+  return Object::MakeRef<List>(elements, parent);
 }
 
 }  // namespace kaubo::IR
@@ -29,6 +29,8 @@ class MapKlass : public INodeTrait, public Object::KlassBase<MapKlass> {
 
 class Map : public INode {
  public:
+  using KlassType = MapKlass;
+
   explicit Map(
     Object::PyListPtr keys,
     Object::PyListPtr values,
@@ -46,14 +48,14 @@ class Map : public INode {
   Object::PyListPtr values;
 };
 
-using MapPtr = std::shared_ptr<Map>;
+using MapPtr = Object::Ref<Map>;
 
 inline INodePtr CreateMap(
   const Object::PyListPtr& keys,
   const Object::PyListPtr& values,
   const INodePtr& parent
 ) {
-  return std::make_shared<Map>(keys, values, parent);
+  return Object::MakeRef<Map>(keys, values, parent);
 }
 
 }  // namespace kaubo::IR
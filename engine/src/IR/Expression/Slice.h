@@ -28,6 +28,8 @@ class SliceKlass : public INodeTrait, public Object::KlassBase<SliceKlass> {
 // 作为右值的list
 class Slice : public INode {
  public:
+  using KlassType = SliceKlass;
+
   explicit Slice(Object::PyListPtr elements, INodePtr parent)
     : INode(SliceKlass::Self(), std::move(parent)),
       elements(std::move(elements)) {}
@@ -38,11 +40,11 @@ class Slice : public INode {
   Object::PyListPtr elements;
 };
 
-using SlicePtr = std::shared_ptr<Slice>;
+using SlicePtr = Object::Ref<Slice>;
 
 inline INodePtr
 CreateSlice(const Object::PyListPtr& elements, const INodePtr& parent) {
-  return std::make_shared<Slice>(elements, parent);
+  return Object::MakeRef<Slice>(elements, parent);
 }
 
 }  // namespace kaubo::IR
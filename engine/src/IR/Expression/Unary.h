@@ -28,6 +28,8 @@ class UnaryKlass : public INodeTrait, public Object::KlassBase<UnaryKlass> {
 
 class Unary : public IR::INode {
  public:
+  using KlassType = UnaryKlass;
+
   enum class Operator : uint8_t {
     PLUS,   // +
     MINUS,  // -
@@ -51,7 +53,7 @@ class Unary : public IR::INode {
 
 inline INodePtr
 CreateUnary(Unary::Operator oprt, INodePtr operand, INodePtr parent) {
-  return std::make_shared<Unary>(oprt, std::move(operand), std::move(parent));
+  return Object::MakeRef<Unary>(oprt, std::move(operand), std::move(parent));
 }
 
 }  // namespace kaubo::IR
@@ -28,6 +28,8 @@ class YieldExprKlass : public INodeTrait,
 
 class YieldExpr : public INode {
  public:
+  using KlassType = YieldExprKlass;
+
   explicit YieldExpr(INodePtr content, INodePtr parent)
     : INode(YieldExprKlass::Self(), std::move(parent)),
       content(std::move(content)) {}
@@ -39,7 +41,7 @@ class YieldExpr : public INode {
 };
 
 inline INodePtr CreateYieldExpr(INodePtr content, INodePtr parent) {
-  return std::make_shared<YieldExpr>(std::move(content), std::move(parent));
+  return Object::MakeRef<YieldExpr>(std::move(content), std::move(parent));
 }
 
 }  // namespace kaubo::IR
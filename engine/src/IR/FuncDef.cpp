@@ -78,6 +78,8 @@ Object::PyObjPtr FuncDefKlass::emit(
   }
   selfCode->LoadConst(Object::PyNone::Create());
   selfCode->ReturnValue();
+  selfCode->FuseSuperInstructions();
+  selfCode->ComputeStackSize();
   auto parent = GetCodeFromList(codeList, funcDef->Parent());
   parent->LoadConst(selfCode);
   parent->LoadConst(funcDef->Name());
@@ -26,6 +26,8 @@ class FuncDefKlass : public INodeTrait, public Object::KlassBase<FuncDefKlass> {
 
 class FuncDef : public INode {
  public:
+  using KlassType = FuncDefKlass;
+
   explicit FuncDef(
     Object::PyStrPtr name,
     Object::PyListPtr parameters,
@@ -49,6 +51,12 @@ class FuncDef : public INode {
 
   void SetBody(const Object::PyListPtr& _body) { this->body = _body; }
 
+ protected:
+  void ReleaseReferences() noexcept override {
+    INode::ReleaseReferences();
+    parents = nullptr;
+  }
+
  private:
   Object::PyStrPtr name;
   Object::PyListPtr body;
@@ -64,6 +72,6 @@ inline INodePtr CreateFuncDef(
   const Object::PyListPtr& body,
   const INodePtr& parent
 ) {
-  return std::make_shared<FuncDef>(name, parameters, body, parent);
+  return Object::MakeRef<FuncDef>(name, parameters, body, parent);
 }
 }  // namespace kaubo::IR
@@ -28,7 +28,7 @@ GetCodeFromList(const Object::PyObjPtr& codeList, const INodePtr& node) {
 }
 void PrintNode(const Object::PyObjPtr& node, const Object::PyStrPtr& text) {
   IntermediateRepresentationTerminal::get_instance().info(
-    Function::Identity(Object::PyList::Create<Object::PyObjPtr>({node}))
+    Function::Identity(nullptr, &node, 1)
       ->str()
       ->as<Object::PyString>()
       ->ToCppString()
@@ -44,7 +44,7 @@ void PrintEdge(
   const Object::PyStrPtr& text
 ) {
   IntermediateRepresentationTerminal::get_instance().info(
-    Function::Identity(Object::PyList::Create<Object::PyObjPtr>({parent}))
+    Function::Identity(nullptr, &parent, 1)
       ->str()
       ->as<Object::PyString>()
       ->ToCppString()
@@ -58,7 +58,7 @@ void PrintEdge(
     IntermediateRepresentationTerminal::get_instance().info(" -->");
   }
   IntermediateRepresentationTerminal::get_instance().info(
-    Function::Identity(Object::PyList::Create<Object::PyObjPtr>({child}))
+    Function::Identity(nullptr, &child, 1)
       ->str()
       ->as<Object::PyString>()
       ->ToCppString()
@@ -1,5 +1,7 @@
 #pragma once
 #include <cstdint>
+#include <new>
+#include "IR/NodeArena.h"
 #include "Object/Core/PyObject.h"
 #include "Object/Runtime/PyCode.h"
 namespace kaubo::IR {
@@ -34,12 +36,48 @@ class INodeTrait {
 
 class INode;
 
-using INodePtr = std::shared_ptr<INode>;
+using INodePtr = Object::Ref<INode>;
 
 class INode : public Object::PyObject {
  public:
   explicit INode(Object::KlassPtr klass, INodePtr parent)
-    : PyObject(klass), parent(std::move(parent)) {}
+    : PyObject(klass),
+      parent(std::move(parent)),
+      trait(dynamic_cast<INodeTrait*>(klass)),
+      arena(NodeArena::Current()) {
+    if (arena != nullptr) {
+      arenaIndex = arena->Register(this);
+    }
+  }
+
+  ~INode() override {
+    if (arena != nullptr) {
+      arena->Unregister(arenaIndex);
+    }
+  }
+
+  INode(const INode&) = delete;
+  INode& operator=(const INode&) = delete;
+  INode(INode&&) = delete;
+  INode& operator=(INode&&) = delete;
+
+  /**
+   * @brief 编译期间结点从当前的分配区分配，没有分配区时退回全局的 operator new
+   */
+  static void* operator new(std::size_t bytes) {
+    auto* current = NodeArena::Current();
+    return current != nullptr ? current->Allocate(bytes)
+                              : ::operator new(bytes);
+  }
+
+  // 只有构造失败和不在分配区中的结点会走到这里，分配区中的内存随分配区释放
+  static void operator delete(void* pointer) noexcept {
+    auto* current = NodeArena::Current();
+    if (current != nullptr && current->Owns(pointer)) {
+      return;
+    }
+    ::operator delete(pointer);
+  }
 
   [[nodiscard]] INodePtr Parent() const { return parent; }
 
@@ -48,8 +86,8 @@ class INode : public Object::PyObject {
    * 遍历AST树，在当前INode节点所属的PyCode对象中注册常量表(consts)，变量表(names)
    */
   virtual Object::PyObjPtr visit(const Object::PyObjPtr& codeList) {
-    return dynamic_cast<INodeTrait*>(Klass())->visit(
-      shared_from_this(), codeList
+    return trait->visit(
+      Object::PyObjPtr(this), codeList
     );
   }
 
@@ -58,8 +96,8 @@ class INode : public Object::PyObject {
    * 遍历AST树，在当前INode节点所属的PyCode对象中生成字节码
    */
   virtual Object::PyObjPtr emit(const Object::PyObjPtr& codeList) {
-    return dynamic_cast<INodeTrait*>(Klass())->emit(
-      shared_from_this(), codeList
+    return trait->emit(
+      Object::PyObjPtr(this), codeList
     );
   }
 
@@ -68,11 +106,33 @@ class INode : public Object::PyObject {
    * 遍历AST树，在当前INode节点所属的PyCode对象中打印AST树
    */
   virtual Object::PyObjPtr print() {
-    return dynamic_cast<INodeTrait*>(Klass())->print(shared_from_this());
+    return trait->print(Object::PyObjPtr(this));
+  }
+
+ protected:
+  /**
+   * @brief 放下指向祖先结点的引用，由分配区在释放整棵树之前调用
+   * @details 子结点到父结点的引用和父结点到子结点的引用构成环，
+   * 记录了祖先链的结点需要一并放下
+   */
+  virtual void ReleaseReferences() noexcept { parent = nullptr; }
+
+  // 分配区中的结点只运行析构函数，内存由分配区整体释放
+  void Dispose() noexcept override {
+    if (arena == nullptr) {
+      delete this;
+      return;
+    }
+    this->~INode();
   }
 
  private:
+  friend class NodeArena;
+
   INodePtr parent;  // 保存父结点在codeList中的索引
+  INodeTrait* trait;  // 构造时解析一次，遍历时不再 dynamic_cast
+  NodeArena* arena;
+  Index arenaIndex = 0;
 };
 
 Object::PyCodePtr
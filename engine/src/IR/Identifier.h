@@ -29,6 +29,8 @@ class IdentifierKlass : public INodeTrait,
 
 class Identifier : public INode {
  public:
+  using KlassType = IdentifierKlass;
+
   explicit Identifier(Object::PyStrPtr _name, INodePtr parent)
     : INode(IdentifierKlass::Self(), std::move(parent)),
       name(std::move(_name)) {}
@@ -45,6 +47,10 @@ class Identifier : public INode {
         Object::PyString::Create("len"),
         Object::PyString::Create("__name__"),
         Object::PyString::Create("randint"),
+        Object::PyString::Create("gcCollect"),
+        Object::PyString::Create("gcStats"),
+        Object::PyString::Create("memstats"),
+        Object::PyString::Create("poolStats"),
         Object::PyString::Create("sleep"),
         Object::PyString::Create("input"),
         Object::PyString::Create("next"),
@@ -95,11 +101,11 @@ class Identifier : public INode {
   Object::PyListPtr builtins;
 };
 
-using IdentifierPtr = std::shared_ptr<Identifier>;
+using IdentifierPtr = Object::Ref<Identifier>;
 
 inline INodePtr
 CreateIdentifier(const Object::PyStrPtr& name, const INodePtr& parent) {
-  return std::make_shared<Identifier>(name, parent);
+  return Object::MakeRef<Identifier>(name, parent);
 }
 
 enum class IdentifierRegistry : uint8_t {
@@ -27,6 +27,8 @@ class MemberAccessKlass : public INodeTrait,
 
 class MemberAccess : public INode {
  public:
+  using KlassType = MemberAccessKlass;
+
   MemberAccess(INodePtr obj, Object::PyStrPtr member, const INodePtr& parent)
     : INode(MemberAccessKlass::Self(), parent),
       obj(std::move(obj)),
@@ -46,14 +48,14 @@ class MemberAccess : public INode {
   STOREORLOAD mode = STOREORLOAD::LOAD;
 };
 
-using MemberAccessPtr = std::shared_ptr<MemberAccess>;
+using MemberAccessPtr = Object::Ref<MemberAccess>;
 
 inline INodePtr CreateMemberAccess(
   const INodePtr& obj,
   const Object::PyStrPtr& member,
   const INodePtr& parent
 ) {
-  return std::make_shared<MemberAccess>(obj, member, parent);
+  return Object::MakeRef<MemberAccess>(obj, member, parent);
 }
 
 }  // namespace kaubo::IR
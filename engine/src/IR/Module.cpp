@@ -36,6 +36,8 @@ Object::PyObjPtr ModuleKlass::emit(
   auto selfCode = GetCodeFromList(codeList, module);
   selfCode->LoadConst(Object::PyNone::Create());
   selfCode->ReturnValue();
+  selfCode->FuseSuperInstructions();
+  selfCode->ComputeStackSize();
   return Object::PyNone::Create();
 }
 
@@ -26,6 +26,8 @@ class ModuleKlass : public INodeTrait, public Object::KlassBase<ModuleKlass> {
 
 class Module : public INode {
  public:
+  using KlassType = ModuleKlass;
+
   explicit Module(Object::PyListPtr body, Object::PyStrPtr name)
     : INode(ModuleKlass::Self(), nullptr),
       body(std::move(body)),
@@ -47,11 +49,11 @@ class Module : public INode {
   Index codeIndex{};  // 保存当前FuncDef对应的PyCode对象在codeList中的索引
 };
 
-using ModulePtr = std::shared_ptr<Module>;
+using ModulePtr = Object::Ref<Module>;
 
 inline INodePtr
 CreateModule(const Object::PyListPtr& body, const Object::PyStrPtr& name) {
-  return std::make_shared<Module>(body, name);
+  return Object::MakeRef<Module>(body, name);
 }
 
 }  // namespace kaubo::IR
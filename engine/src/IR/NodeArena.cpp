@@ -0,0 +1,77 @@
+#include "IR/NodeArena.h"
+#include "IR/INode.h"
+
+namespace kaubo::IR {
+
+NodeArena::~NodeArena() {
+  Deactivate();
+  if (live != 0) {
+    return;
+  }
+  for (Index i = 0; i < chunks.Size(); i++) {
+    delete[] chunks[i].data;
+  }
+}
+
+void NodeArena::Activate() noexcept {
+  previous = current;
+  current = this;
+}
+
+void NodeArena::Deactivate() noexcept {
+  if (current == this) {
+    current = previous;
+    previous = nullptr;
+  }
+}
+
+void* NodeArena::Allocate(Index bytes) {
+  const Index size = (bytes + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+  if (top == nullptr || static_cast<Index>(end - top) < size) {
+    // 超过块大小的结点单独占一块，之后仍从新块继续切
+    const Index capacity = size > CHUNK_SIZE ? size : CHUNK_SIZE;
+    auto* chunk = new std::byte[capacity];
+    chunks.Push(Chunk{chunk, capacity});
+    top = chunk;
+    end = chunk + capacity;
+  }
+  void* block = top;
+  top += size;
+  return block;
+}
+
+bool NodeArena::Owns(const void* pointer) const noexcept {
+  const auto* byte = static_cast<const std::byte*>(pointer);
+  for (Index i = 0; i < chunks.Size(); i++) {
+    const auto& chunk = chunks[i];
+    if (byte >= chunk.data && byte < chunk.data + chunk.size) {
+      return true;
+    }
+  }
+  return false;
+}
+
+Index NodeArena::Register(INode* node) {
+  nodes.Push(node);
+  live++;
+  return nodes.Size() - 1;
+}
+
+void NodeArena::Unregister(Index index) noexcept {
+  nodes[index] = nullptr;
+  live--;
+}
+
+void NodeArena::Release() noexcept {
+  Deactivate();
+  // 拆引用的过程中可能有结点随之析构，每次都重新读取登记表
+  for (Index i = 0; i < nodes.Size(); i++) {
+    if (nodes[i] == nullptr) {
+      continue;
+    }
+    INodePtr node(nodes[i]);
+    node->ReleaseReferences();
+  }
+}
+
+}  // namespace kaubo::IR
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "Collections/List.h"
+#include "Common.h"
+
+#include <cstddef>
+
+namespace kaubo::IR {
+
+class INode;
+
+/**
+ * @brief 一次编译中 IR 结点的分配区
+ * @details 激活期间创建的结点从按块申请的连续内存中依次切出，
+ * 结点析构时只运行析构函数，内存不单独归还；字节码生成完毕后调用 Release，
+ * 拆开结点与父结点之间的引用环，放下根结点后所有结点依次析构，
+ * 分配区析构时再把所有块一次性退回。
+ * 若仍有结点被编译器之外的对象持有，块会保留下来而不是释放，避免悬空引用
+ */
+class NodeArena {
+ public:
+  NodeArena() = default;
+  ~NodeArena();
+  NodeArena(const NodeArena&) = delete;
+  NodeArena& operator=(const NodeArena&) = delete;
+  NodeArena(NodeArena&&) = delete;
+  NodeArena& operator=(NodeArena&&) = delete;
+
+  /**
+   * @brief 当前线程正在使用的分配区，没有时返回 nullptr
+   */
+  [[nodiscard]] static NodeArena* Current() noexcept { return current; }
+
+  /**
+   * @brief 之后在当前线程创建的结点都从这个分配区分配
+   */
+  void Activate() noexcept;
+
+  /**
+   * @brief 停止从这个分配区分配，恢复激活前的分配区
+   */
+  void Deactivate() noexcept;
+
+  [[nodiscard]] void* Allocate(Index bytes);
+
+  [[nodiscard]] bool Owns(const void* pointer) const noexcept;
+
+  /**
+   * @brief 登记新建的结点，返回它在分配区中的编号
+   */
+  Index Register(INode* node);
+
+  void Unregister(Index index) noexcept;
+
+  /**
+   * @brief 拆开所有存活结点与父结点之间的引用，调用方随后放下根结点
+   */
+  void Release() noexcept;
+
+  [[nodiscard]] Index LiveNodes() const noexcept { return live; }
+
+ private:
+  static constexpr Index CHUNK_SIZE = Index{64} * 1024;
+  static constexpr Index ALIGNMENT = alignof(std::max_align_t);
+
+  // 超过 CHUNK_SIZE 的结点单独占一块，所以每块都记下自己的大小
+  struct Chunk {
+    std::byte* data;
+    Index size;
+  };
+
+  Collections::List<Chunk> chunks;
+  std::byte* top = nullptr;
+  std::byte* end = nullptr;
+  Collections::List<INode*> nodes;
+  Index live = 0;
+  NodeArena* previous = nullptr;
+
+  inline static thread_local NodeArena* current = nullptr;
+};
+
+}  // namespace kaubo::IR
@@ -28,6 +28,8 @@ class ExprStmtKlass : public INodeTrait,
 
 class ExprStmt : public INode {
  public:
+  using KlassType = ExprStmtKlass;
+
   explicit ExprStmt(INodePtr content, INodePtr parent)
     : INode(ExprStmtKlass::Self(), std::move(parent)),
       content(std::move(content)) {}
@@ -40,7 +42,7 @@ class ExprStmt : public INode {
 
 inline INodePtr
 CreateExprStmt(const INodePtr& content, const INodePtr& parent) {
-  return std::make_shared<ExprStmt>(content, parent);
+  return Object::MakeRef<ExprStmt>(content, parent);
 }
 
 }  // namespace kaubo::IR
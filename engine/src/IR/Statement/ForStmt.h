@@ -26,6 +26,8 @@ class ForStmtKlass : public INodeTrait, public Object::KlassBase<ForStmtKlass> {
 
 class ForStmt : public INode {
  public:
+  using KlassType = ForStmtKlass;
+
   explicit ForStmt(
     INodePtr target,
     INodePtr iter,
@@ -55,7 +57,7 @@ inline INodePtr CreateForStmt(
   const Object::PyListPtr& body,
   const INodePtr& parent
 ) {
-  return std::make_shared<ForStmt>(target, iter, body, parent);
+  return Object::MakeRef<ForStmt>(target, iter, body, parent);
 }
 
 }  // namespace kaubo::IR
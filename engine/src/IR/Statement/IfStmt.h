@@ -27,6 +27,8 @@ class IfStmtKlass : public INodeTrait, public Object::KlassBase<IfStmtKlass> {
 
 class IfStmt : public INode {
  public:
+  using KlassType = IfStmtKlass;
+
   explicit IfStmt(
     INodePtr condition,
     Object::PyListPtr thenStmts,
@@ -70,7 +72,7 @@ inline INodePtr CreateIfStmt(
   const Object::PyListPtr& elifConditions,
   const INodePtr& parent
 ) {
-  return std::make_shared<IfStmt>(
+  return Object::MakeRef<IfStmt>(
     condition, thenStmts, elseStmts, elifs, elifConditions, parent
   );
 }
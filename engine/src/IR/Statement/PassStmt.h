@@ -33,12 +33,14 @@ class PassStmtKlass : public INodeTrait,
 
 class PassStmt : public INode {
  public:
+  using KlassType = PassStmtKlass;
+
   explicit PassStmt(const INodePtr& parent)
     : INode(PassStmtKlass::Self(), parent) {}
 };
 
 inline INodePtr CreatePassStmt(const INodePtr& parent) {
-  return std::make_shared<PassStmt>(parent);
+  return Object::MakeRef<PassStmt>(parent);
 }
 
 }  // namespace kaubo::IR
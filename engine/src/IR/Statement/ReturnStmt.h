@@ -28,6 +28,8 @@ class ReturnStmtKlass : public INodeTrait,
 
 class ReturnStmt : public INode {
  public:
+  using KlassType = ReturnStmtKlass;
+
   explicit ReturnStmt(INodePtr content, INodePtr parent)
     : INode(ReturnStmtKlass::Self(), std::move(parent)),
       content(std::move(content)) {}
@@ -39,7 +41,7 @@ class ReturnStmt : public INode {
 };
 
 inline INodePtr CreateReturnStmt(INodePtr content, INodePtr parent) {
-  return std::make_shared<ReturnStmt>(std::move(content), std::move(parent));
+  return Object::MakeRef<ReturnStmt>(std::move(content), std::move(parent));
 }
 
 }  // namespace kaubo::IR
@@ -28,6 +28,8 @@ class WhileStmtKlass : public INodeTrait,
 
 class WhileStmt : public INode {
  public:
+  using KlassType = WhileStmtKlass;
+
   explicit WhileStmt(
     INodePtr condition,
     Object::PyListPtr body,
@@ -51,7 +53,7 @@ inline INodePtr CreateWhileStmt(
   const Object::PyListPtr& body,
   INodePtr parent
 ) {
-  return std::make_shared<WhileStmt>(
+  return Object::MakeRef<WhileStmt>(
     std::move(condition), body, std::move(parent)
   );
 }
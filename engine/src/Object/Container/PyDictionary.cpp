@@ -12,11 +12,26 @@
 namespace kaubo::Object {
 
 void PyDictionary::Put(const PyObjPtr& key, const PyObjPtr& value) {
-  dict.insert_or_assign(key, value);
+  if (dict.insert_or_assign(key, value).second) {
+    version = NextVersion();
+  }
 }
 
 PyObjPtr PyDictionary::Get(const PyObjPtr& key) {
-  return dict[key];
+  // 与 operator[] 一致：不存在的键会插入一个空值，这也算一次修改
+  auto [entry, inserted] = dict.try_emplace(key);
+  if (inserted) {
+    version = NextVersion();
+  }
+  return entry->second;
+}
+
+PyObjPtr* PyDictionary::Slot(const PyObjPtr& key) {
+  auto dictIter = dict.find(key);
+  if (dictIter != dict.end()) {
+    return &dictIter->second;
+  }
+  return nullptr;
 }
 
 PyObjPtr PyDictionary::TryGet(const PyObjPtr& key) const {
@@ -27,8 +42,17 @@ PyObjPtr PyDictionary::TryGet(const PyObjPtr& key) const {
   return nullptr;  // 表示没有找到
 }
 
+void PyDictionary::Traverse(GcVisitor& visitor) {
+  for (const auto& item : dict) {
+    visitor.Visit(item.first);
+    visitor.Visit(item.second);
+  }
+}
+
 void PyDictionary::Remove(const PyObjPtr& key) {
-  dict.erase(key);
+  if (dict.erase(key) != 0) {
+    version = NextVersion();
+  }
 }
 
 bool PyDictionary::Contains(const PyObjPtr& key) {
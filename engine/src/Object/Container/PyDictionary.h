@@ -33,12 +33,51 @@ class DictionaryKlass : public KlassBase<DictionaryKlass> {
 
 // bool KeyCompare(const PyObjPtr& lhs, const PyObjPtr& rhs);
 
-class PyDictionary : public PyObject, public IObjectCreator<PyDictionary> {
+class PyDictionary : public PyContainer,
+                     public IObjectCreator<PyDictionary> {
  private:
   std::unordered_map<PyObjPtr, PyObjPtr> dict;
+  Index version;
+
+  /**
+   * @brief 所有字典共用一个递增的版本号来源
+   * @details 键集合每次变化都从这里取新值，所以版本号相同意味着
+   * 是同一个字典且键集合没有变化，从不分配 0
+   */
+  static Index NextVersion() {
+    static Index counter = 0;
+    return ++counter;
+  }
 
  public:
-  explicit PyDictionary() : PyObject(DictionaryKlass::Self()) {}
+  using KlassType = DictionaryKlass;
+
+  explicit PyDictionary()
+    : PyContainer(DictionaryKlass::Self()), version(NextVersion()) {}
+
+  void Traverse(GcVisitor& visitor) override;
+
+  void ClearReferences() override { Clear(); }
+
+  /**
+   * @details 哈希表的桶数组加上每个节点（链表指针、键值和缓存的哈希）
+   */
+  [[nodiscard]] Index MemoryFootprint() const override {
+    return sizeof(PyDictionary) + dict.bucket_count() * sizeof(void*) +
+           dict.size() * (sizeof(void*) * 2 + sizeof(PyObjPtr) * 2);
+  }
+
+  /**
+   * @brief 键集合的版本标记，增加或删除键时更新，只修改已有键的值时不变
+   * @details 供 LOAD_GLOBAL / LOAD_NAME 的查找缓存校验。版本不变时
+   * unordered_map 中已有元素的地址也不变，缓存可以直接持有值所在的槽位
+   */
+  [[nodiscard]] Index Version() const { return version; }
+
+  /**
+   * @brief 键对应的值所在的槽位，键不存在时返回 nullptr
+   */
+  PyObjPtr* Slot(const PyObjPtr& key);
 
   void Put(const PyObjPtr& key, const PyObjPtr& value);
 
@@ -55,10 +94,13 @@ class PyDictionary : public PyObject, public IObjectCreator<PyDictionary> {
   PyObjPtr TryGet(const PyObjPtr& key) const;
 
   PyDictPtr Add(const PyDictPtr& other);
-  void Clear() { dict.clear(); }
+  void Clear() {
+    dict.clear();
+    version = NextVersion();
+  }
   auto Dictionary() -> decltype(dict) { return dict; }
 };
-using PyDictPtr = std::shared_ptr<PyDictionary>;
+using PyDictPtr = Ref<PyDictionary>;
 
 auto DictClear(const PyObjPtr& obj) -> PyObjPtr;
 auto DictItems(const PyObjPtr& obj) -> PyObjPtr;
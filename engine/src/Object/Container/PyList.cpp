@@ -20,7 +20,7 @@
 
 namespace kaubo::Object {
 
-PyList::PyList(ExpandAndFill reserve) : PyObject(ListKlass::Self()) {
+PyList::PyList(ExpandAndFill reserve) : PyContainer(ListKlass::Self()) {
   if (reserve.capacity == 0) {
     return;
   }
@@ -28,7 +28,7 @@ PyList::PyList(ExpandAndFill reserve) : PyObject(ListKlass::Self()) {
   m_list.Fill(PyNone::Create());
 }
 
-PyList::PyList(ExpandOnly reserve) : PyObject(ListKlass::Self()) {
+PyList::PyList(ExpandOnly reserve) : PyContainer(ListKlass::Self()) {
   if (reserve.capacity == 0) {
     return;
   }
@@ -530,7 +530,7 @@ PyObjPtr PyList::GetSlice(const PySlicePtr& slice) const {
   return subList;
 }
 
-PyList::PyList(const PyObjPtr& iterator) : PyObject(ListKlass::Self()) {
+PyList::PyList(const PyObjPtr& iterator) : PyContainer(ListKlass::Self()) {
   auto iter = iterator->iter();
   auto value = iter->next();
   Collections::List<PyObjPtr> list;
@@ -538,7 +538,7 @@ PyList::PyList(const PyObjPtr& iterator) : PyObject(ListKlass::Self()) {
     list.Push(value);
     value = iter->next();
   }
-  this->m_list = list;
+  this->m_list = std::move(list);
 }
 
 }  // namespace kaubo::Object
\ No newline at end of file
@@ -33,12 +33,18 @@ class ListKlass : public KlassBase<ListKlass> {
 };
 
 class PyList;
-using PyListPtr = std::shared_ptr<PyList>;
-class PyList : public PyObject, public IObjectCreator<PyList> {
+using PyListPtr = Ref<PyList>;
+/**
+ * @brief PyList 的元素存储，参数列表这类不超过 4 个元素的短列表存放在对象内部
+ */
+using PyListElements = Collections::List<PyObjPtr, 4>;
+class PyList : public PyContainer, public IObjectCreator<PyList> {
  private:
-  Collections::List<PyObjPtr> m_list;
+  PyListElements m_list;
 
  public:
+  using KlassType = ListKlass;
+
   struct ExpandOnly {
     Index capacity;
   };
@@ -46,16 +52,28 @@ class PyList : public PyObject, public IObjectCreator<PyList> {
   struct ExpandAndFill {
     Index capacity;
   };
-  explicit PyList(Collections::List<PyObjPtr> value)
-    : PyObject(ListKlass::Self()), m_list(std::move(value)) {}
+  explicit PyList(PyListElements value)
+    : PyContainer(ListKlass::Self()), m_list(std::move(value)) {}
   explicit PyList(ExpandOnly reserve);
   explicit PyList(ExpandAndFill reserve);
   PyList(std::initializer_list<PyObjPtr> list)
-    : PyObject(ListKlass::Self()), m_list(list) {}
-  explicit PyList() : PyObject(ListKlass::Self()) {}
+    : PyContainer(ListKlass::Self()), m_list(list) {}
+  explicit PyList() : PyContainer(ListKlass::Self()) {}
 
   explicit PyList(const PyObjPtr& iterator);
 
+  void Traverse(GcVisitor& visitor) override {
+    for (Index i = 0; i < m_list.Size(); i++) {
+      visitor.Visit(m_list[i]);
+    }
+  }
+
+  void ClearReferences() override { m_list = PyListElements(); }
+
+  [[nodiscard]] Index MemoryFootprint() const override {
+    return sizeof(PyList) + m_list.HeapBytes();
+  }
+
   void Shuffle() { m_list.Shuffle(); }
   void Append(const PyObjPtr& obj) { m_list.Push(obj); }
   PyObjPtr Add(const PyObjPtr& obj) {
@@ -65,10 +83,14 @@ class PyList : public PyObject, public IObjectCreator<PyList> {
   bool Contains(const PyObjPtr& obj) const { return m_list.Contains(obj); }
   Index IndexOf(const PyObjPtr& obj) const { return m_list.IndexOf(obj); }
   PyObjPtr GetItem(Index index) const { return m_list[index]; }
+  /**
+   * @brief 元素的连续存储，追加或删除元素后失效
+   */
+  [[nodiscard]] const PyObjPtr* Data() const { return m_list.Data(); }
   PyObjPtr GetSlice(const PySlicePtr& slice) const;
   void SetItem(Index index, const PyObjPtr& obj) { m_list.Set(index, obj); }
   PyObjPtr Prepend(const PyObjPtr& obj) {
-    return PyList::Create({obj})->Add(shared_from_this());
+    return PyList::Create({obj})->Add(PyObjPtr(this));
   }
   void RemoveAt(Index index) { m_list.RemoveAt(index); }
   void InsertAndReplace(Index start, Index end, const PyListPtr& list) {
@@ -103,26 +103,6 @@ PyObjPtr BindSelf(const PyObjPtr& obj, const PyObjPtr& attr) {
   return attr;
 }
 
-void CacheAttr(
-  const Object::PyObjPtr& obj,
-  const Object::PyObjPtr& key,
-  const Object::PyObjPtr& attr
-) {
-  if (attr->is(FunctionKlass::Self())) {
-    obj->Methods()->Put(key, attr);
-    return;
-  }
-  if (attr->is(NativeFunctionKlass::Self())) {
-    obj->Methods()->Put(key, attr);
-    return;
-  }
-  if (attr->is(IifeKlass::Self())) {
-    obj->Attributes()->Put(key, attr);
-    return;
-  }
-  obj->Attributes()->Put(key, attr);
-}
-
 PyObjPtr GetBases(const PyObjPtr& args) {
   CheckNativeFunctionArgumentsWithExpectedLength(args, 1);
   return args->as<PyList>()->GetItem(0)->Klass()->Type()->Owner()->Super();
@@ -134,7 +114,11 @@ PyObjPtr GetMro(const PyObjPtr& args) {
 PyObjPtr GetDict(const PyObjPtr& args) {
   CheckNativeFunctionArgumentsWithExpectedLength(args, 1);
   auto obj = args->as<PyList>()->GetItem(0);
-  return obj->Attributes()->Add(obj->Methods())->as<PyDictionary>();
+  auto* instance = obj->AsInstance();
+  if (instance == nullptr) {
+    return PyDictionary::Create();
+  }
+  return instance->AttributeDict();
 }
 PyListPtr ComputeMro(const PyTypePtr& type) {
   auto oldMro = type->Owner()->Mro();
@@ -302,11 +286,12 @@ bool CouldTypePlaceAhead(
 }
 
 PyObjPtr KlassStr(const PyObjPtr& args) {
+  auto self = args->as<PyList>()->GetItem(0);
   return StringConcat(
     PyList::Create<PyObjPtr>(
-      {PyString::Create("<"), args->as<PyList>()->GetItem(0)->Klass()->Name(),
-       PyString::Create(" object at "), Function::Identity(args),
-       PyString::Create(">")}
+      {PyString::Create("<"), self->Klass()->Name(),
+       PyString::Create(" object at "),
+       Function::Identity(nullptr, &self, 1), PyString::Create(">")}
     )
   );
 }
@@ -317,11 +302,12 @@ PyObjPtr Repr(const PyObjPtr& args) {
 }
 
 PyObjPtr KlassRepr(const PyObjPtr& args) {
+  auto self = args->as<PyList>()->GetItem(0);
   return StringConcat(
     PyList::Create<PyObjPtr>(
-      {PyString::Create("<"), args->as<PyList>()->GetItem(0)->Klass()->Name(),
-       PyString::Create(" object at "), Function::Identity(args),
-       PyString::Create(">")}
+      {PyString::Create("<"), self->Klass()->Name(),
+       PyString::Create(" object at "),
+       Function::Identity(nullptr, &self, 1), PyString::Create(">")}
     )
   );
 }
@@ -17,11 +17,6 @@ Object::PyObjPtr
 GetAttr(const Object::PyObjPtr& obj, const Object::PyStrPtr& attrName) noexcept;
 Object::PyObjPtr
 BindSelf(const Object::PyObjPtr& obj, const Object::PyObjPtr& attr);
-void CacheAttr(
-  const Object::PyObjPtr& obj,
-  const Object::PyObjPtr& key,
-  const Object::PyObjPtr& attr
-);
 Object::PyObjPtr GetBases(const Object::PyObjPtr& args);
 Object::PyObjPtr GetMro(const Object::PyObjPtr& args);
 Object::PyObjPtr GetDict(const Object::PyObjPtr& args);
@@ -1,19 +1,20 @@
 #pragma once
 
-#include <memory>
+#include "Object/Core/Ref.h"
+#include "Runtime/ObjectPool.h"
 
 namespace kaubo::Object {
 template <typename T>
 class IObjectCreator {
  public:
   template <typename... Args>
-  static std::shared_ptr<T> Create(Args&&... args) {
-    return std::make_shared<T>(std::forward<Args>(args)...);
+  static Ref<T> Create(Args&&... args) {
+    return MakeRef<T>(std::forward<Args>(args)...);
   }
 
   template <typename U>
-  static std::shared_ptr<T> Create(std::initializer_list<U> list) {
-    return std::make_shared<T>(list);  // 转发给 T 的构造函数
+  static Ref<T> Create(std::initializer_list<U> list) {
+    return MakeRef<T>(list);  // 转发给 T 的构造函数
   }
 
   virtual ~IObjectCreator() = default;
@@ -22,5 +23,35 @@ class IObjectCreator {
   IObjectCreator& operator=(const IObjectCreator&) = delete;
   IObjectCreator(IObjectCreator&&) = delete;
   IObjectCreator& operator=(IObjectCreator&&) = delete;
+
+#if KAUBO_OBJECT_POOL
+  /**
+   * @brief 从当前线程的对象池分配，按实际大小（可能是派生类）分级
+   */
+  static void* operator new(std::size_t bytes) {
+    void* memory = Runtime::ObjectPool::Allocate(bytes);
+    Runtime::ObjectPool::CountAllocation(counters);
+    return memory;
+  }
+
+  static void* operator new(std::size_t /*bytes*/, void* place) noexcept {
+    return place;
+  }
+
+  static void operator delete(void* pointer, std::size_t bytes) noexcept {
+    Runtime::ObjectPool::CountDeallocation(counters);
+    Runtime::ObjectPool::Deallocate(pointer, bytes);
+  }
+
+  static void operator delete(void* /*pointer*/, void* /*place*/) noexcept {}
+
+ private:
+  static Klass* KlassOf() { return T::KlassType::Self(); }
+
+  // 按线程计数，与对象池一样不需要加锁
+  inline static thread_local Runtime::ObjectPool::TypeCounters counters{
+    &KlassOf, 0, 0, false
+  };
+#endif
 };
 }  // namespace kaubo::Object
\ No newline at end of file
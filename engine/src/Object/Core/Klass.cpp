@@ -18,8 +18,16 @@ void Klass::SetName(const PyStrPtr& _name) {
   this->name = _name;
 }
 
+void Klass::BumpVersion() {
+  version = NextVersion();
+  for (Index i = 0; i < subclasses.Size(); i++) {
+    subclasses[i]->version = NextVersion();
+  }
+}
+
 void Klass::SetAttributes(const PyDictPtr& _attributes) {
   this->attributes = _attributes;
+  BumpVersion();
 }
 
 void Klass::SetType(const PyTypePtr& _type) {
@@ -32,11 +40,18 @@ void Klass::SetSuper(const PyListPtr& _super) {
 
 void Klass::SetMro(const PyListPtr& _mro) {
   this->mro = _mro;
+  for (Index i = 1; i < _mro->Length(); i++) {
+    auto* base = _mro->GetItem(i)->as<PyType>()->Owner();
+    if (!base->subclasses.Contains(this)) {
+      base->subclasses.Push(this);
+    }
+  }
+  BumpVersion();
 }
 
 PyObjPtr Klass::init(const PyObjPtr& typeObj, const PyObjPtr& args) {
   auto* instanceType = typeObj->as<PyType>()->Owner();
-  auto instance = std::make_shared<PyObject>(instanceType);
+  auto instance = MakeRef<PyInstance>(instanceType);
   if (instanceType->IsNative()) {
     return instance;
   }
@@ -115,7 +130,7 @@ PyObjPtr Klass::repr(const PyObjPtr& self) {
         {PyString::Create("<"),
          self->getattr(PyString::Create("__name__")->as<PyString>()),
          PyString::Create(" object at "),
-         Function::Identity(PyList::Create({self})), PyString::Create(">")}
+         Function::Identity(nullptr, &self, 1), PyString::Create(">")}
       )
     );
   }
@@ -128,7 +143,7 @@ PyObjPtr Klass::repr(const PyObjPtr& self) {
       {PyString::Create("<"),
        self->getattr(PyString::Create("__name__")->as<PyString>()),
        PyString::Create(" object at "),
-       Function::Identity(PyList::Create({self})), PyString::Create(">")}
+       Function::Identity(nullptr, &self, 1), PyString::Create(">")}
     )
   );
 }
@@ -225,25 +240,22 @@ PyObjPtr Klass::getattr(const PyObjPtr& obj, const PyObjPtr& key) {
   }
   auto keyStr = key->as<PyString>();
   // attr为nullptr说明没有重载，直接返回属性
-  if (obj->Attributes()->Contains(keyStr)) {
-    auto attr = obj->Attributes()->Get(keyStr);
-    if (attr->is(IifeKlass::Self())) {
-      return attr->as<PyIife>()->Call(PyList::Create({obj}));
+  auto own = obj->TryGetOwnAttribute(keyStr);
+  if (own != nullptr) {
+    if (own->is(IifeKlass::Self())) {
+      return own->as<PyIife>()->Call(PyList::Create({obj}));
     }
-    return attr;
-  }
-  if (obj->Methods()->Contains(keyStr)) {
-    return BindSelf(obj, obj->Methods()->Get(keyStr));
+    return own;
   }
   // 如果getattr被重载，那么调用重载的函数
   auto attr = GetAttr(obj, PyString::Create("__getattr__")->as<PyString>());
   if (attr != nullptr) {
     return Runtime::Evaluator::InvokeCallable(attr, PyList::Create({key}));
   }
-  // 对象属性内部没有找到，查找父类
+  // 对象属性内部没有找到，查找父类。找到的属性不复制进实例，
+  // 否则会改变实例的形状，类上的属性之后被修改时也看不到
   attr = GetAttr(obj, keyStr);
   if (attr != nullptr) {
-    CacheAttr(obj, keyStr, attr);
     return BindSelf(obj, attr);
   }
   return nullptr;
@@ -262,7 +274,14 @@ PyObjPtr Klass::setattr(
       );
     }
   }
-  obj->Attributes()->Put(key->as<PyString>(), value);
+  auto* instance = obj->AsInstance();
+  if (instance == nullptr) {
+    throw std::runtime_error(
+      "AttributeError: '" + obj->Klass()->Name()->ToCppString() +
+      "' object has no attribute '" + key->as<PyString>()->ToCppString() + "'"
+    );
+  }
+  instance->SetOwnAttribute(key->as<PyString>(), value);
   return PyNone::Create();
 }
 
@@ -303,5 +322,6 @@ PyObjPtr Klass::_serialize_(const PyObjPtr& obj) {
 
 void Klass::AddAttribute(const PyStrPtr& key, const PyObjPtr& value) {
   this->attributes->Put(key, value);
+  BumpVersion();
 }
 }  // namespace kaubo::Object
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Collections/List.h"
 #include "Object/Object.h"
 
 #include <stdexcept>
@@ -14,6 +15,16 @@ class Klass {
   PyListPtr mro;
   bool isNative{};
   bool isInitialized = false;
+  Index version;
+  // MRO 中包含本类的所有类，本类变化时一并更新它们的版本
+  Collections::List<Klass*> subclasses;
+
+  static Index NextVersion() {
+    static Index counter = 0;
+    return ++counter;
+  }
+
+  void BumpVersion();
 
  public:
   explicit Klass()
@@ -21,7 +32,8 @@ class Klass {
       attributes(nullptr),
       type(nullptr),
       super(nullptr),
-      mro(nullptr) {}
+      mro(nullptr),
+      version(NextVersion()) {}
 
   void SetName(const PyStrPtr& _name);
   void SetAttributes(const PyDictPtr& _attributes);
@@ -44,6 +56,13 @@ class Klass {
   [[nodiscard]] PyDictPtr Attributes() const { return attributes; }
   [[nodiscard]] PyListPtr Super() const { return super; }
   [[nodiscard]] PyListPtr Mro() const { return mro; }
+  /**
+   * @brief 属性查找结果的版本标记
+   * @details 本类或其 MRO 中任一类的属性字典被替换、经 AddAttribute
+   * 写入，或 MRO 被重新设置时更新。供 LOAD_ATTR / STORE_ATTR 的内联缓存
+   * 校验，版本号从不为 0
+   */
+  [[nodiscard]] Index Version() const { return version; }
   virtual PyObjPtr init(const PyObjPtr& typeObj, const PyObjPtr& args);
   virtual PyObjPtr add(const PyObjPtr& lhs, const PyObjPtr& rhs);
   virtual PyObjPtr sub(const PyObjPtr& lhs, const PyObjPtr& rhs);
@@ -7,7 +7,7 @@
 namespace kaubo::Object {
 
 class PyBoolean;
-using PyBoolPtr = std::shared_ptr<PyBoolean>;
+using PyBoolPtr = Ref<PyBoolean>;
 
 class BooleanKlass : public KlassBase<BooleanKlass> {
  public:
@@ -37,6 +37,8 @@ class PyBoolean : public PyObject, public IObjectCreator<PyBoolean> {
   bool value;
 
  public:
+  using KlassType = BooleanKlass;
+
   explicit PyBoolean(bool value)
     : PyObject(BooleanKlass::Self()), value(value) {}
   static PyBoolPtr False() {
@@ -37,7 +37,7 @@ PyObjPtr NoneKlass::boolean(const PyObjPtr& obj) {
 PyNone::PyNone() : PyObject(NoneKlass::Self()) {}
 
 PyNonePtr PyNone::Instance() {
-  static PyNonePtr instance = std::make_shared<PyNone>();
+  static PyNonePtr instance = MakeRef<PyNone>();
   return instance;
 }
 
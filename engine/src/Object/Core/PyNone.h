@@ -28,9 +28,11 @@ class NoneKlass : public KlassBase<NoneKlass> {
   PyObjPtr _serialize_(const PyObjPtr& obj) override;
 };
 class PyNone;
-using PyNonePtr = std::shared_ptr<PyNone>;
+using PyNonePtr = Ref<PyNone>;
 class PyNone : public PyObject, public IObjectCreator<PyNone> {
  public:
+  using KlassType = NoneKlass;
+
   explicit PyNone();
   static PyNonePtr Instance();
 
@@ -6,29 +6,109 @@
 #include "Object/Function/PyNativeFunction.h"
 #include "Object/Object.h"
 #include "Object/String/PyString.h"
+#include "Runtime/GarbageCollector.h"
 #include "Runtime/VirtualMachine.h"
 
 namespace kaubo::Object {
 
-PyDictPtr PyObject::Attributes() noexcept {
-  if (attributes == nullptr) {
-    attributes = PyDictionary::Create();
+PyObjPtr PyObject::TryGetOwnAttribute(const PyObjPtr& key) {
+  auto* instance = AsInstance();
+  if (instance == nullptr) {
+    return nullptr;
   }
-  return attributes;
+  return instance->GetOwnAttribute(key);
 }
 
-PyDictPtr PyObject::Methods() noexcept {
-  if (methods == nullptr) {
-    methods = PyDictionary::Create();
+PyContainer::PyContainer(KlassPtr klass) : PyObject(klass) {
+  Runtime::GarbageCollector::Instance().Track(this);
+}
+
+PyContainer::~PyContainer() {
+  Runtime::GarbageCollector::Instance().Untrack(this);
+}
+
+PyContainer::PyContainer(const PyContainer& other) : PyObject(other) {
+  Runtime::GarbageCollector::Instance().Track(this);
+}
+
+PyContainer& PyContainer::operator=(const PyContainer& other) {
+  PyObject::operator=(other);
+  return *this;
+}
+
+PyContainer::PyContainer(PyContainer&& other) noexcept
+  : PyObject(std::move(other)) {
+  Runtime::GarbageCollector::Instance().Track(this);
+}
+
+PyContainer& PyContainer::operator=(PyContainer&& other) noexcept {
+  PyObject::operator=(std::move(other));
+  return *this;
+}
+
+void PyInstance::Traverse(GcVisitor& visitor) {
+  for (Index i = 0; i < slots.Size(); i++) {
+    visitor.Visit(slots[i]);
   }
-  return methods;
+  visitor.Visit(attributes);
+}
+
+void PyInstance::ClearReferences() {
+  shape = Shape::Empty();
+  slots = Collections::List<PyObjPtr>();
+  attributes = nullptr;
+}
+
+PyObjPtr PyInstance::GetOwnAttribute(const PyObjPtr& key) {
+  if (shape == nullptr) {
+    return attributes->TryGet(key);
+  }
+  auto slot = shape->Find(key);
+  return slot == Shape::NOT_FOUND ? nullptr : slots[slot];
+}
+
+void PyInstance::SetOwnAttribute(const PyObjPtr& key, const PyObjPtr& value) {
+  if (shape == nullptr) {
+    attributes->Put(key, value);
+    return;
+  }
+  auto slot = shape->Find(key);
+  if (slot != Shape::NOT_FOUND) {
+    slots[slot] = value;
+    return;
+  }
+  auto* next = shape->WithAttribute(key);
+  if (next != nullptr) {
+    AppendSlot(next, value);
+    return;
+  }
+  // 属性太多，改用字典存放
+  SetAttributes(AttributeDict());
+  attributes->Put(key, value);
+}
+
+PyDictPtr PyInstance::AttributeDict() {
+  if (shape == nullptr) {
+    return PyDictionary::Create()->Add(attributes);
+  }
+  auto dict = PyDictionary::Create();
+  for (Index i = 0; i < shape->SlotCount(); i++) {
+    dict->Put(shape->KeyAt(i), slots[i]);
+  }
+  return dict;
+}
+
+void PyInstance::SetAttributes(const PyDictPtr& _attributes) {
+  attributes = _attributes;
+  shape = nullptr;
+  slots = Collections::List<PyObjPtr>();
 }
 
 PyObjPtr ObjectInit(const PyObjPtr& args) {
   CheckNativeFunctionArgumentsWithExpectedLength(args, 1);
   auto self = args->as<PyList>()->GetItem(0);
   auto* klass = self->Klass();
-  auto instance = std::make_shared<PyObject>(klass);
+  auto instance = MakeRef<PyInstance>(klass);
   return instance;
 }
 
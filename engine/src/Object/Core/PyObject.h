@@ -2,40 +2,104 @@
 
 #include "Common.h"
 #include "Object/Core/Klass.h"
+#include "Object/Core/Shape.h"
 #include "Object/Object.h"
+#include "Runtime/MemoryStats.h"
+
+#include <stdexcept>
+#include <type_traits>
+
+namespace kaubo::Runtime {
+class GarbageCollector;
+}  // namespace kaubo::Runtime
 
 namespace kaubo::Object {
 
-class PyObject : public std::enable_shared_from_this<PyObject> {
+/**
+ * @brief 对象类型是否通过 KlassType 声明了它唯一对应的 Klass
+ */
+template <typename T, typename = void>
+struct HasKlassType : std::false_type {};
+
+template <typename T>
+struct HasKlassType<T, std::void_t<typename T::KlassType>> : std::true_type {};
+
+class PyInstance;
+class PyContainer;
+
+/**
+ * @brief 所有对象的基类
+ * @details 对象头只保留引用计数、类型和哈希缓存。数值、字符串这类值对象
+ * 不能拥有实例属性，实例属性字典放在派生的 PyInstance 里。
+ * 两个标记字段排在最前，可以放进引用计数之后的填充字节
+ */
+class PyObject : public RefCounted {
  private:
-  KlassPtr klass;
-  PyDictPtr attributes;  // 不需要bound的属性
-  PyDictPtr methods;     // 需要bound的属性
-  Index hashValue{};
   bool hashed = false;
   bool isMarked = false;  // 垃圾回收标记位
+  KlassPtr klass;
+  Index hashValue{};
+#if KAUBO_MEMORY_STATS
+  friend class Runtime::MemoryStats;
+  // 内存统计串起所有存活对象的链表
+  PyObject* statsPrev = nullptr;
+  PyObject* statsNext = nullptr;
+#endif
 
  public:
+#if KAUBO_MEMORY_STATS
+  explicit PyObject(KlassPtr klass) : klass(klass) {
+    Runtime::MemoryStats::Track(this);
+  }
+  ~PyObject() override { Runtime::MemoryStats::Untrack(this); }
+  PyObject(const PyObject& other)
+    : RefCounted(other),
+      hashed(other.hashed),
+      klass(other.klass),
+      hashValue(other.hashValue) {
+    Runtime::MemoryStats::Track(this);
+  }
+  PyObject(PyObject&& other) noexcept : PyObject(other) {}
+  PyObject& operator=(const PyObject& other) {
+    hashed = other.hashed;
+    klass = other.klass;
+    hashValue = other.hashValue;
+    return *this;
+  }
+  PyObject& operator=(PyObject&& other) noexcept { return *this = other; }
+#else
   explicit PyObject(KlassPtr klass) : klass(klass) {}
+  ~PyObject() override = default;
+  PyObject(const PyObject&) = default;
+  PyObject& operator=(const PyObject&) = default;
+  PyObject(PyObject&&) = default;
+  PyObject& operator=(PyObject&&) = default;
+#endif
 
-  // 垃圾回收支持
+  // 垃圾回收支持，回收器用标记位记录本轮可达的容器
   bool IsMarked() const { return isMarked; }
   void SetMarked(bool marked) { isMarked = marked; }
 
-  // virtual void Mark() = 0;
-
-  // virtual void Create() = 0;
-
   [[nodiscard]] KlassPtr Klass() const { return klass; }
-  [[nodiscard]] PyDictPtr Attributes() noexcept;
-  [[nodiscard]] PyDictPtr Methods() noexcept;
-  void SetAttributes(const PyDictPtr& _attributes) { attributes = _attributes; }
+  /**
+   * @brief 能拥有实例属性的对象返回自身，值对象返回 nullptr
+   */
+  [[nodiscard]] virtual PyInstance* AsInstance() noexcept { return nullptr; }
+  /**
+   * @brief 可能持有其他对象、参与引用环的容器返回自身，其余返回 nullptr
+   */
+  [[nodiscard]] virtual PyContainer* AsContainer() noexcept { return nullptr; }
+  /**
+   * @brief 只在实例自身的属性中查找，属性字典尚未创建时不会创建它
+   */
+  [[nodiscard]] PyObjPtr TryGetOwnAttribute(const PyObjPtr& key);
   void SetKlass(const KlassPtr& _klass) { klass = _klass; }
-  virtual ~PyObject() = default;
-  PyObject(const PyObject&) = default;
-  PyObject& operator=(const PyObject&) = default;
-  PyObject(PyObject&&) = default;
-  PyObject& operator=(PyObject&&) = default;
+  /**
+   * @brief 对象本身和它直接持有的堆存储占用的大致字节数，供内存统计使用
+   */
+  [[nodiscard]] virtual Index MemoryFootprint() const {
+    return sizeof(PyObject);
+  }
   void SetHashValue(Index value) {
     hashValue = value;
     hashed = true;
@@ -43,101 +107,252 @@ class PyObject : public std::enable_shared_from_this<PyObject> {
   [[nodiscard]] Index HashValue() const { return hashValue; }
   [[nodiscard]] bool Hashed() const { return hashed; }
   PyObjPtr add(const PyObjPtr& other) {
-    return klass->add(shared_from_this(), other);
+    return klass->add(PyObjPtr(this), other);
   }
   PyObjPtr sub(const PyObjPtr& other) {
-    return klass->sub(shared_from_this(), other);
+    return klass->sub(PyObjPtr(this), other);
   }
   PyObjPtr mul(const PyObjPtr& other) {
-    return klass->mul(shared_from_this(), other);
+    return klass->mul(PyObjPtr(this), other);
   }
   PyObjPtr floordiv(const PyObjPtr& other) {
-    return klass->floordiv(shared_from_this(), other);
+    return klass->floordiv(PyObjPtr(this), other);
   }
   PyObjPtr mod(const PyObjPtr& other) {
-    return klass->mod(shared_from_this(), other);
+    return klass->mod(PyObjPtr(this), other);
   }
   PyObjPtr truediv(const PyObjPtr& other) {
-    return klass->truediv(shared_from_this(), other);
+    return klass->truediv(PyObjPtr(this), other);
   }
   PyObjPtr matmul(const PyObjPtr& other) {
-    return klass->matmul(shared_from_this(), other);
+    return klass->matmul(PyObjPtr(this), other);
   }
-  PyObjPtr pos() { return klass->pos(shared_from_this()); }
-  PyObjPtr neg() { return klass->neg(shared_from_this()); }
-  PyObjPtr invert() { return klass->invert(shared_from_this()); }
+  PyObjPtr pos() { return klass->pos(PyObjPtr(this)); }
+  PyObjPtr neg() { return klass->neg(PyObjPtr(this)); }
+  PyObjPtr invert() { return klass->invert(PyObjPtr(this)); }
   PyObjPtr _and_(const PyObjPtr& other) {
-    return klass->_and_(shared_from_this(), other);
+    return klass->_and_(PyObjPtr(this), other);
   }
   PyObjPtr _or_(const PyObjPtr& other) {
-    return klass->_or_(shared_from_this(), other);
+    return klass->_or_(PyObjPtr(this), other);
   }
   PyObjPtr _xor_(const PyObjPtr& other) {
-    return klass->_xor_(shared_from_this(), other);
+    return klass->_xor_(PyObjPtr(this), other);
   }
   PyObjPtr lshift(const PyObjPtr& other) {
-    return klass->lshift(shared_from_this(), other);
+    return klass->lshift(PyObjPtr(this), other);
   }
   PyObjPtr rshift(const PyObjPtr& other) {
-    return klass->rshift(shared_from_this(), other);
+    return klass->rshift(PyObjPtr(this), other);
   }
   PyObjPtr pow(const PyObjPtr& other) {
-    return klass->pow(shared_from_this(), other);
+    return klass->pow(PyObjPtr(this), other);
   }
   PyObjPtr gt(const PyObjPtr& other) {
-    return klass->gt(shared_from_this(), other);
+    return klass->gt(PyObjPtr(this), other);
   }
   PyObjPtr lt(const PyObjPtr& other) {
-    return klass->lt(shared_from_this(), other);
+    return klass->lt(PyObjPtr(this), other);
   }
   PyObjPtr eq(const PyObjPtr& other) {
-    return klass->eq(shared_from_this(), other);
+    return klass->eq(PyObjPtr(this), other);
   }
   PyObjPtr ge(const PyObjPtr& other) {
-    return klass->ge(shared_from_this(), other);
+    return klass->ge(PyObjPtr(this), other);
   }
   PyObjPtr le(const PyObjPtr& other) {
-    return klass->le(shared_from_this(), other);
+    return klass->le(PyObjPtr(this), other);
   }
   PyObjPtr ne(const PyObjPtr& other) {
-    return klass->ne(shared_from_this(), other);
+    return klass->ne(PyObjPtr(this), other);
   }
-  PyObjPtr hash() { return klass->hash(shared_from_this()); }
-  PyObjPtr repr() { return klass->repr(shared_from_this()); }
-  PyObjPtr str() { return klass->str(shared_from_this()); }
+  PyObjPtr hash() { return klass->hash(PyObjPtr(this)); }
+  PyObjPtr repr() { return klass->repr(PyObjPtr(this)); }
+  PyObjPtr str() { return klass->str(PyObjPtr(this)); }
   PyObjPtr getitem(const PyObjPtr& key) {
-    return klass->getitem(shared_from_this(), key);
+    return klass->getitem(PyObjPtr(this), key);
   }
   PyObjPtr setitem(const PyObjPtr& key, const PyObjPtr& value) {
-    return klass->setitem(shared_from_this(), key, value);
+    return klass->setitem(PyObjPtr(this), key, value);
   }
   PyObjPtr delitem(const PyObjPtr& key) {
-    return klass->delitem(shared_from_this(), key);
+    return klass->delitem(PyObjPtr(this), key);
   }
   PyObjPtr contains(const PyObjPtr& key) {
-    return klass->contains(shared_from_this(), key);
+    return klass->contains(PyObjPtr(this), key);
   }
-  PyObjPtr len() { return klass->len(shared_from_this()); }
-  PyObjPtr boolean() { return klass->boolean(shared_from_this()); }
+  PyObjPtr len() { return klass->len(PyObjPtr(this)); }
+  PyObjPtr boolean() { return klass->boolean(PyObjPtr(this)); }
   PyObjPtr getattr(const PyObjPtr& key) {
-    return klass->getattr(shared_from_this(), key);
+    return klass->getattr(PyObjPtr(this), key);
   }
   PyObjPtr setattr(const PyObjPtr& key, const PyObjPtr& value) {
-    return klass->setattr(shared_from_this(), key, value);
+    return klass->setattr(PyObjPtr(this), key, value);
   }
-  PyObjPtr iter() { return klass->iter(shared_from_this()); }
-  PyObjPtr next() { return klass->next(shared_from_this()); }
-  PyObjPtr reversed() { return klass->reversed(shared_from_this()); }
-  PyObjPtr _serialize_() { return klass->_serialize_(shared_from_this()); }
+  PyObjPtr iter() { return klass->iter(PyObjPtr(this)); }
+  PyObjPtr next() { return klass->next(PyObjPtr(this)); }
+  PyObjPtr reversed() { return klass->reversed(PyObjPtr(this)); }
+  PyObjPtr _serialize_() { return klass->_serialize_(PyObjPtr(this)); }
   bool is(const KlassPtr& _klass) { return klass == _klass; }
 
+  /**
+   * @brief 转换成具体的对象类型，类型不符时返回 nullptr
+   * @details 声明了 KlassType 的类型只比较 Klass 指针再静态转换，
+   * INode 这类没有唯一 Klass 的基类才使用 dynamic_cast
+   */
+  template <typename T>
+  Ref<T> as() {
+    return Ref<T>(Cast<T>());
+  }
+
+  /**
+   * @brief 供已经检查过类型的解释器内部使用，直接静态转换并借出指针
+   * @details 调试构建中仍然检查类型，不符时抛出异常
+   */
+  template <typename T>
+  T* unchecked_as() {
+#ifndef NDEBUG
+    if (Cast<T>() == nullptr) {
+      throw std::runtime_error("unchecked_as(): object type mismatch");
+    }
+#endif
+    return static_cast<T*>(this);
+  }
+
+ private:
   template <typename T>
-  std::shared_ptr<T> as() {
-    return std::dynamic_pointer_cast<T>(shared_from_this());
+  T* Cast() {
+    if constexpr (std::is_base_of_v<T, PyObject>) {
+      return this;
+    } else if constexpr (HasKlassType<T>::value) {
+      return klass == T::KlassType::Self() ? static_cast<T*>(this) : nullptr;
+    } else {
+      return dynamic_cast<T*>(this);
+    }
   }
 };
 
-using PyObjPtr = std::shared_ptr<PyObject>;
+using PyObjPtr = Ref<PyObject>;
+
+/**
+ * @brief 遍历容器直接持有的引用
+ */
+class GcVisitor {
+ public:
+  GcVisitor() = default;
+  virtual ~GcVisitor() = default;
+  GcVisitor(const GcVisitor&) = delete;
+  GcVisitor& operator=(const GcVisitor&) = delete;
+  GcVisitor(GcVisitor&&) = delete;
+  GcVisitor& operator=(GcVisitor&&) = delete;
+
+  template <typename T>
+  void Visit(const Ref<T>& ref) {
+    if (ref != nullptr) {
+      VisitObject(ref.get());
+    }
+  }
+
+ protected:
+  virtual void VisitObject(PyObject* object) = 0;
+};
+
+/**
+ * @brief 垃圾回收器串起同一代容器的链表节点
+ */
+struct GcLink {
+  GcLink* gcPrev = nullptr;
+  GcLink* gcNext = nullptr;
+};
+
+/**
+ * @brief 可能参与引用环的容器对象
+ * @details 构造时登记到垃圾回收器的最年轻一代，析构时摘除。
+ * Traverse 必须恰好报告对象持有的每一个计数引用：报告少了只会让回收
+ * 更保守，报告多了会把仍在使用的对象当成垃圾。ClearReferences 由回收器
+ * 对不可达的容器调用，放下全部引用以拆开引用环
+ */
+class PyContainer : public PyObject, public GcLink {
+ private:
+  friend class Runtime::GarbageCollector;
+
+  uint32_t gcRefs = 0;     // 回收过程中减去容器间引用后剩下的计数
+  uint8_t generation = 0;  // 所在的代，GENERATIONS 表示正在被回收
+
+ public:
+  explicit PyContainer(KlassPtr klass);
+  ~PyContainer() override;
+  PyContainer(const PyContainer& other);
+  PyContainer& operator=(const PyContainer& other);
+  PyContainer(PyContainer&& other) noexcept;
+  PyContainer& operator=(PyContainer&& other) noexcept;
+
+  [[nodiscard]] PyContainer* AsContainer() noexcept override { return this; }
+
+  virtual void Traverse(GcVisitor& visitor) = 0;
+
+  virtual void ClearReferences() = 0;
+};
+
+/**
+ * @brief 可以拥有实例属性的对象：用户类的实例、类对象和函数
+ * @details 属性默认按形状存放在槽位数组里；类对象共用类的属性字典，
+ * 属性过多的实例也改用字典，这时 shape 为 nullptr
+ */
+class PyInstance : public PyContainer {
+ private:
+  Shape* shape = Shape::Empty();
+  Collections::List<PyObjPtr> slots;
+  PyDictPtr attributes;  // 字典模式下的属性
+
+ public:
+  explicit PyInstance(KlassPtr klass) : PyContainer(klass) {}
+
+  [[nodiscard]] PyInstance* AsInstance() noexcept override { return this; }
+
+  [[nodiscard]] Index MemoryFootprint() const override {
+    return sizeof(PyInstance) + slots.HeapBytes();
+  }
+
+  void Traverse(GcVisitor& visitor) override;
+
+  void ClearReferences() override;
+
+  /**
+   * @brief 当前的形状，字典模式下为 nullptr
+   */
+  [[nodiscard]] Shape* GetShape() const noexcept { return shape; }
+
+  /**
+   * @brief 按形状给出的下标读写槽位，调用方保证下标属于当前形状
+   */
+  [[nodiscard]] PyObjPtr& SlotAt(Index slot) { return slots[slot]; }
+
+  /**
+   * @brief 追加一个槽位并切换到 next，next 必须是当前形状的直接转移
+   */
+  void AppendSlot(Shape* next, const PyObjPtr& value) {
+    slots.Push(value);
+    shape = next;
+  }
+
+  /**
+   * @brief 实例自身的属性，不存在时返回 nullptr
+   */
+  [[nodiscard]] PyObjPtr GetOwnAttribute(const PyObjPtr& key);
+  void SetOwnAttribute(const PyObjPtr& key, const PyObjPtr& value);
+
+  /**
+   * @brief 把实例属性复制成一个新字典，供 __dict__ 和调试输出使用
+   * @details 只在需要时才生成，修改它不会影响实例
+   */
+  [[nodiscard]] PyDictPtr AttributeDict();
+
+  /**
+   * @brief 改为直接使用给定的属性字典，类对象借此共用类的属性
+   */
+  void SetAttributes(const PyDictPtr& _attributes);
+};
 
 class ObjectKlass : public KlassBase<ObjectKlass> {
  public:
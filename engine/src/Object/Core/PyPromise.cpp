@@ -14,16 +14,30 @@
 namespace kaubo::Object {
 
 PyPromise::PyPromise(PyObjPtr executor)
-  : PyObject(PromiseKlass::Self()),
+  : PyContainer(PromiseKlass::Self()),
     state(State::PENDING),
     value(PyNone::Create()),
     onFulfilledCallbacks(PyList::Create()),
     onRejectedCallbacks(PyList::Create()),
     executor(std::move(executor)) {}
 
+void PyPromise::Traverse(GcVisitor& visitor) {
+  visitor.Visit(value);
+  visitor.Visit(onFulfilledCallbacks);
+  visitor.Visit(onRejectedCallbacks);
+  visitor.Visit(executor);
+}
+
+void PyPromise::ClearReferences() {
+  value = nullptr;
+  onFulfilledCallbacks = nullptr;
+  onRejectedCallbacks = nullptr;
+  executor = nullptr;
+}
+
 PyPromisePtr CreatePyPromise(const PyObjPtr& executor) {
-  auto promise = std::make_shared<PyPromise>(executor);
-  auto self = promise->shared_from_this()->as<PyPromise>();
+  auto promise = MakeRef<PyPromise>(executor);
+  auto self = promise->as<PyPromise>();
   auto resolve = PyNativeFunction::Create([self](const PyObjPtr& args) {
     auto val = args->as<PyList>()->GetItem(0);
     if (self->GetState() == PyPromise::State::PENDING) {
@@ -79,7 +93,7 @@ PyPromisePtr CreatePyPromise(const PyObjPtr& executor) {
 }
 
 PyPromisePtr PyPromise::Then(const PyObjPtr& onFulfilled) {
-  auto self = shared_from_this()->as<PyPromise>();
+  auto self = as<PyPromise>();
   auto new_executor =
     PyNativeFunction::Create([self, onFulfilled](const PyObjPtr& args) {
       auto argList = args->as<PyList>();
@@ -116,7 +130,7 @@ PyPromisePtr PyPromise::Then(const PyObjPtr& onFulfilled) {
 }
 
 PyPromisePtr PyPromise::Catch(const PyObjPtr& onRejected) {
-  auto self = shared_from_this()->as<PyPromise>();
+  auto self = as<PyPromise>();
   auto new_executor =
     PyNativeFunction::Create([self, onRejected](const PyObjPtr& args) {
       auto argList = args->as<PyList>();
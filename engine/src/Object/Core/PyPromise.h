@@ -7,10 +7,14 @@
 namespace kaubo::Object {
 
 class PyPromise;
-using PyPromisePtr = std::shared_ptr<PyPromise>;
+using PyPromisePtr = Ref<PyPromise>;
 
-class PyPromise : public PyObject {
+class PromiseKlass;
+
+class PyPromise : public PyContainer {
  public:
+  using KlassType = PromiseKlass;
+
   enum class State : std::uint8_t { PENDING, FULFILLED, REJECTED };
 
   explicit PyPromise(PyObjPtr executor);
@@ -29,6 +33,10 @@ class PyPromise : public PyObject {
 
   PyListPtr GetOnRejectedCallbacks() const { return onRejectedCallbacks; }
 
+  void Traverse(GcVisitor& visitor) override;
+
+  void ClearReferences() override;
+
  private:
   State state;
   PyObjPtr value;
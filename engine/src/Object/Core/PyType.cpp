@@ -1,5 +1,6 @@
 #include "Object/Core/PyType.h"
 #include "Object/Core/PyBoolean.h"
+#include "Object/Core/PyNone.h"
 #include "Object/String/PyString.h"
 namespace kaubo::Object {
 
@@ -11,7 +12,8 @@ void TypeKlass::Initialize() {
   this->SetInitialized();
 }
 
-PyType::PyType(KlassPtr _owner) : PyObject(TypeKlass::Self()), owner(_owner) {
+PyType::PyType(KlassPtr _owner)
+  : PyInstance(TypeKlass::Self()), owner(_owner) {
   this->SetAttributes(owner->Attributes());
 }
 
@@ -34,4 +36,13 @@ PyObjPtr TypeKlass::eq(const PyObjPtr& lhs, const PyObjPtr& rhs) {
   return PyBoolean::Create(lhsType->Owner() == rhsType->Owner());
 }
 
+PyObjPtr TypeKlass::setattr(
+  const PyObjPtr& obj,
+  const PyObjPtr& key,
+  const PyObjPtr& value
+) {
+  obj->as<PyType>()->Owner()->AddAttribute(key->as<PyString>(), value);
+  return PyNone::Create();
+}
+
 }  // namespace kaubo::Object
@@ -15,22 +15,33 @@ class TypeKlass : public KlassBase<TypeKlass> {
   PyObjPtr repr(const PyObjPtr& obj) override;
 
   PyObjPtr str(const PyObjPtr& obj) override { return repr(obj); }
+
+  /**
+   * @brief 给类对象赋值属性，写入类自身的属性字典并更新类的版本
+   */
+  PyObjPtr setattr(
+    const PyObjPtr& obj,
+    const PyObjPtr& key,
+    const PyObjPtr& value
+  ) override;
 };
 
-class PyType : public PyObject {
+class PyType : public PyInstance {
  private:
   KlassPtr owner;
 
  public:
+  using KlassType = TypeKlass;
+
   explicit PyType(KlassPtr _owner);
 
   [[nodiscard]] KlassPtr Owner() const { return owner; }
 };
 
-using PyTypePtr = std::shared_ptr<PyType>;
+using PyTypePtr = Ref<PyType>;
 
 inline PyObjPtr CreatePyType(KlassPtr owner) {
-  auto type = std::make_shared<PyType>(owner)->as<PyType>();
+  auto type = MakeRef<PyType>(owner)->as<PyType>();
   return type;
 }
 }  // namespace kaubo::Object
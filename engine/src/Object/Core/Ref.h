@@ -0,0 +1,229 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief 引用计数是否使用原子操作
+ * @details 解释器只在一个线程里运行对象，默认使用普通整数计数；
+ * 嵌入到多线程宿主、对象会跨线程传递时可以在编译时定义
+ * KAUBO_ATOMIC_REFCOUNT=1
+ */
+#ifndef KAUBO_ATOMIC_REFCOUNT
+#define KAUBO_ATOMIC_REFCOUNT 0
+#endif
+
+namespace kaubo::Object {
+
+/**
+ * @brief 侵入式引用计数的基类
+ * @details 计数直接放在对象头里，不再需要 std::shared_ptr 的控制块。
+ * 计数归零时调用 Dispose 释放对象，默认是 delete this，
+ * 由别处分配内存的对象（例如分配区里的帧）可以覆盖它
+ */
+class RefCounted {
+ public:
+  RefCounted() = default;
+  // 复制或移动对象时不复制计数，新对象从 0 开始
+  RefCounted(const RefCounted& /*other*/) noexcept {}
+  RefCounted& operator=(const RefCounted& /*other*/) noexcept { return *this; }
+  RefCounted(RefCounted&& /*other*/) noexcept {}
+  RefCounted& operator=(RefCounted&& /*other*/) noexcept { return *this; }
+  virtual ~RefCounted() = default;
+
+  void IncRef() const noexcept {
+#if KAUBO_ATOMIC_REFCOUNT
+    refCount.fetch_add(1, std::memory_order_relaxed);
+#else
+    ++refCount;
+#endif
+  }
+
+  void DecRef() const noexcept {
+#if KAUBO_ATOMIC_REFCOUNT
+    if (refCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+#else
+    if (--refCount == 0) {
+#endif
+      const_cast<RefCounted*>(this)->Dispose();
+    }
+  }
+
+  [[nodiscard]] uint32_t RefCount() const noexcept { return refCount; }
+
+ protected:
+  virtual void Dispose() noexcept { delete this; }
+
+ private:
+#if KAUBO_ATOMIC_REFCOUNT
+  mutable std::atomic<uint32_t> refCount{0};
+#else
+  mutable uint32_t refCount{0};
+#endif
+};
+
+/**
+ * @brief 持有一个引用的句柄，接口与 std::shared_ptr 的常用部分一致
+ * @details 计数在对象里，所以从裸指针重新得到句柄总是安全的：
+ * 函数可以用 const Ref<T>& 或 T* 借用引用，需要保存时再构造 Ref。
+ * 句柄内部只保存 RefCounted 指针，复制、比较和析构句柄都不要求 T
+ * 是完整类型，只有构造和解引用时才需要
+ */
+template <typename T>
+class Ref {
+ public:
+  using element_type = T;
+
+  constexpr Ref() noexcept = default;
+
+  constexpr Ref(std::nullptr_t /*null*/) noexcept {}
+
+  explicit Ref(T* pointer) noexcept : counted(pointer) { Acquire(); }
+
+  Ref(const Ref& other) noexcept : counted(other.counted) { Acquire(); }
+
+  Ref(Ref&& other) noexcept : counted(other.counted) {
+    other.counted = nullptr;
+  }
+
+  template <
+    typename U,
+    typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+  Ref(const Ref<U>& other) noexcept : counted(other.counted) {
+    Acquire();
+  }
+
+  template <
+    typename U,
+    typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+  Ref(Ref<U>&& other) noexcept : counted(other.counted) {
+    other.counted = nullptr;
+  }
+
+  ~Ref() { Release(); }
+
+  Ref& operator=(const Ref& other) noexcept {
+    Ref(other).swap(*this);
+    return *this;
+  }
+
+  Ref& operator=(Ref&& other) noexcept {
+    Ref(std::move(other)).swap(*this);
+    return *this;
+  }
+
+  template <typename U>
+  Ref& operator=(const Ref<U>& other) noexcept {
+    Ref(other).swap(*this);
+    return *this;
+  }
+
+  template <typename U>
+  Ref& operator=(Ref<U>&& other) noexcept {
+    Ref(std::move(other)).swap(*this);
+    return *this;
+  }
+
+  Ref& operator=(std::nullptr_t /*null*/) noexcept {
+    reset();
+    return *this;
+  }
+
+  [[nodiscard]] T* get() const noexcept { return static_cast<T*>(counted); }
+
+  T& operator*() const noexcept { return *get(); }
+
+  T* operator->() const noexcept { return get(); }
+
+  explicit operator bool() const noexcept { return counted != nullptr; }
+
+  void reset() noexcept {
+    Release();
+    counted = nullptr;
+  }
+
+  void swap(Ref& other) noexcept { std::swap(counted, other.counted); }
+
+  /**
+   * @brief 对象的引用计数部分，用于不需要 T 的比较和哈希
+   */
+  [[nodiscard]] const RefCounted* Counted() const noexcept { return counted; }
+
+ private:
+  template <typename U>
+  friend class Ref;
+
+  void Acquire() const noexcept {
+    if (counted != nullptr) {
+      counted->IncRef();
+    }
+  }
+
+  void Release() const noexcept {
+    if (counted != nullptr) {
+      counted->DecRef();
+    }
+  }
+
+  RefCounted* counted = nullptr;
+};
+
+template <typename T, typename... Args>
+Ref<T> MakeRef(Args&&... args) {
+  return Ref<T>(new T(std::forward<Args>(args)...));
+}
+
+template <typename T, typename U>
+Ref<T> StaticRefCast(const Ref<U>& ref) noexcept {
+  return Ref<T>(static_cast<T*>(ref.get()));
+}
+
+template <typename T, typename U>
+Ref<T> DynamicRefCast(const Ref<U>& ref) noexcept {
+  return Ref<T>(dynamic_cast<T*>(ref.get()));
+}
+
+template <typename T, typename U>
+bool operator==(const Ref<T>& lhs, const Ref<U>& rhs) noexcept {
+  return lhs.Counted() == rhs.Counted();
+}
+
+template <typename T, typename U>
+bool operator!=(const Ref<T>& lhs, const Ref<U>& rhs) noexcept {
+  return lhs.Counted() != rhs.Counted();
+}
+
+template <typename T>
+bool operator==(const Ref<T>& lhs, std::nullptr_t /*null*/) noexcept {
+  return lhs.Counted() == nullptr;
+}
+
+template <typename T>
+bool operator==(std::nullptr_t /*null*/, const Ref<T>& rhs) noexcept {
+  return rhs.Counted() == nullptr;
+}
+
+template <typename T>
+bool operator!=(const Ref<T>& lhs, std::nullptr_t /*null*/) noexcept {
+  return lhs.Counted() != nullptr;
+}
+
+template <typename T>
+bool operator!=(std::nullptr_t /*null*/, const Ref<T>& rhs) noexcept {
+  return rhs.Counted() != nullptr;
+}
+
+}  // namespace kaubo::Object
+
+namespace std {
+template <typename T>
+struct hash<kaubo::Object::Ref<T>> {
+  size_t operator()(const kaubo::Object::Ref<T>& ref) const noexcept {
+    return std::hash<const kaubo::Object::RefCounted*>()(ref.Counted());
+  }
+};
+}  // namespace std
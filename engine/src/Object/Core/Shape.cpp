@@ -0,0 +1,36 @@
+#include "Object/Core/Shape.h"
+
+namespace kaubo::Object {
+
+Shape* Shape::Empty() {
+  // 形状被实例和内联缓存以裸指针引用，有意不在退出时析构
+  static auto* root = new Shape();
+  return root;
+}
+
+Index Shape::Find(const PyObjPtr& key) const {
+  // 实例的属性通常不多，顺序比较地址比查哈希表更快
+  for (Index i = 0; i < keys.Size(); i++) {
+    if (keys[i].Counted() == key.Counted()) {
+      return i;
+    }
+  }
+  return NOT_FOUND;
+}
+
+Shape* Shape::WithAttribute(const PyObjPtr& key) {
+  auto iter = transitions.find(key.Counted());
+  if (iter != transitions.end()) {
+    return iter->second;
+  }
+  if (keys.Size() >= KAUBO_SHAPE_MAX_SLOTS) {
+    return nullptr;
+  }
+  auto* next = new Shape();
+  next->keys = keys;
+  next->keys.Push(key);
+  transitions.emplace(key.Counted(), next);
+  return next;
+}
+
+}  // namespace kaubo::Object
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "Collections/List.h"
+#include "Common.h"
+#include "Object/Object.h"
+
+#include <unordered_map>
+
+/**
+ * @brief 一个实例最多按形状存放多少个属性
+ * @details 超过后实例改用属性字典，避免动态生成属性名的对象
+ * 把形状树无限地长下去
+ */
+#ifndef KAUBO_SHAPE_MAX_SLOTS
+#define KAUBO_SHAPE_MAX_SLOTS 64
+#endif
+
+namespace kaubo::Object {
+
+/**
+ * @brief 实例属性的布局（隐藏类）
+ * @details 形状记录属性名到槽位下标的对应关系，实例只保存槽位数组。
+ * 所有形状从同一个空形状出发，按添加属性的顺序连成一棵转移树：
+ * 以相同顺序添加相同属性的实例共用同一个形状，内联缓存可以用
+ * 形状指针代替一次字典查找。形状在进程内一直存在，不会释放。
+ * 字符串都经过驻留，属性名按对象地址比较
+ */
+class Shape {
+ public:
+  static constexpr Index NOT_FOUND = static_cast<Index>(-1);
+
+  /**
+   * @brief 没有任何属性的根形状
+   */
+  static Shape* Empty();
+
+  /**
+   * @brief 属性名对应的槽位下标，不存在时返回 NOT_FOUND
+   */
+  [[nodiscard]] Index Find(const PyObjPtr& key) const;
+
+  /**
+   * @brief 在当前形状上追加一个属性后得到的形状
+   * @details 同一条转移只创建一次；属性数已达 KAUBO_SHAPE_MAX_SLOTS 时
+   * 返回 nullptr，由调用方改用属性字典
+   */
+  [[nodiscard]] Shape* WithAttribute(const PyObjPtr& key);
+
+  [[nodiscard]] Index SlotCount() const { return keys.Size(); }
+
+  [[nodiscard]] const PyObjPtr& KeyAt(Index slot) const { return keys[slot]; }
+
+  Shape(const Shape&) = delete;
+  Shape& operator=(const Shape&) = delete;
+  Shape(Shape&&) = delete;
+  Shape& operator=(Shape&&) = delete;
+  ~Shape() = default;
+
+ private:
+  Shape() = default;
+
+  Collections::List<PyObjPtr> keys;  // 按槽位顺序排列的属性名
+  // 以追加的属性名为键，属性名由子形状的 keys 持有
+  std::unordered_map<const RefCounted*, Shape*> transitions;
+};
+
+}  // namespace kaubo::Object
@@ -8,7 +8,7 @@ PyObjPtr FunctionKlass::repr(const PyObjPtr& obj) {
     PyList::Create<Object::PyObjPtr>(
       {PyString::Create("<function ")->as<PyString>(),
        obj->as<PyFunction>()->Name(), PyString::Create(" at ")->as<PyString>(),
-       Function::Identity(PyList::Create({obj}))->as<PyString>(),
+       Function::Identity(nullptr, &obj, 1)->as<PyString>(),
        PyString::Create(">")->as<PyString>()}
     )
   );
@@ -22,14 +22,16 @@ class FunctionKlass : public KlassBase<FunctionKlass> {
   PyObjPtr repr(const PyObjPtr& obj) override;
 };
 
-class PyFunction : public PyObject {
+class PyFunction : public PyInstance {
  private:
   PyCodePtr code;
   PyDictPtr globals;
 
  public:
+  using KlassType = FunctionKlass;
+
   PyFunction(const PyObjPtr& code, const PyObjPtr& globals)
-    : PyObject(FunctionKlass::Self()),
+    : PyInstance(FunctionKlass::Self()),
       code(code->as<PyCode>()),
       globals(globals->as<PyDictionary>()) {}
 
@@ -38,13 +40,30 @@ class PyFunction : public PyObject {
   [[nodiscard]] PyDictPtr Globals() const { return globals; }
 
   [[nodiscard]] PyStrPtr Name() const { return code->Name(); }
+
+  void Traverse(GcVisitor& visitor) override {
+    PyInstance::Traverse(visitor);
+    visitor.Visit(code);
+    visitor.Visit(globals);
+  }
+
+  void ClearReferences() override {
+    PyInstance::ClearReferences();
+    code = nullptr;
+    globals = nullptr;
+  }
+
+  [[nodiscard]] Index MemoryFootprint() const override {
+    return PyInstance::MemoryFootprint() - sizeof(PyInstance) +
+           sizeof(PyFunction);
+  }
 };
 
-using PyFunctionPtr = std::shared_ptr<PyFunction>;
+using PyFunctionPtr = Ref<PyFunction>;
 
 inline PyObjPtr
 CreatePyFunction(const PyObjPtr& code, const PyObjPtr& globals) {
-  return std::make_shared<PyFunction>(code, globals);
+  return MakeRef<PyFunction>(code, globals);
 }
 
 }  // namespace kaubo::Object
@@ -22,6 +22,8 @@ class PyIife : public PyObject, public IObjectCreator<PyIife> {
   TypeFunction nativeFunction;
 
  public:
+  using KlassType = IifeKlass;
+
   explicit PyIife(TypeFunction nativeFunction)
     : PyObject(IifeKlass::Self()), nativeFunction(std::move(nativeFunction)) {}
 
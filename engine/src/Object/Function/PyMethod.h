@@ -20,10 +20,12 @@ class MethodKlass : public KlassBase<MethodKlass> {
   PyObjPtr repr(const PyObjPtr& obj) override;
 };
 
-class PyMethod : public PyObject, public IObjectCreator<PyMethod> {
+class PyMethod : public PyContainer, public IObjectCreator<PyMethod> {
  public:
+  using KlassType = MethodKlass;
+
   explicit PyMethod(PyObjPtr owner, PyObjPtr method)
-    : PyObject(MethodKlass::Self()),
+    : PyContainer(MethodKlass::Self()),
       owner(std::move(owner)),
       method(std::move(method)) {}
 
@@ -31,10 +33,20 @@ class PyMethod : public PyObject, public IObjectCreator<PyMethod> {
 
   [[nodiscard]] PyObjPtr Owner() const { return owner; }
 
+  void Traverse(GcVisitor& visitor) override {
+    visitor.Visit(owner);
+    visitor.Visit(method);
+  }
+
+  void ClearReferences() override {
+    owner = nullptr;
+    method = nullptr;
+  }
+
  private:
   PyObjPtr owner;
   PyObjPtr method;
 };
-using PyMethodPtr = std::shared_ptr<PyMethod>;
+using PyMethodPtr = Ref<PyMethod>;
 
 }  // namespace kaubo::Object
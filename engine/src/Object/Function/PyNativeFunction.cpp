@@ -6,9 +6,32 @@
 namespace kaubo::Object {
 
 PyObjPtr PyNativeFunction::Call(const PyObjPtr& args) {
+  if (vectorFunction != nullptr) {
+    CheckNativeFunctionArguments(args);
+    auto list = args->as<PyList>();
+    return vectorFunction(nullptr, list->Data(), list->Length());
+  }
   return nativeFunction(args);
 }
 
+PyObjPtr PyNativeFunction::Call(
+  const PyObjPtr& self,
+  const PyObjPtr* args,
+  Index nargs
+) {
+  if (vectorFunction != nullptr) {
+    return vectorFunction(self, args, nargs);
+  }
+  Collections::List<PyObjPtr> arguments(nargs + 1);
+  if (self != nullptr) {
+    arguments.Push(self);
+  }
+  for (Index i = 0; i < nargs; i++) {
+    arguments.Push(args[i]);
+  }
+  return nativeFunction(PyList::Create(std::move(arguments)));
+}
+
 void CheckNativeFunctionArgumentsWithExpectedLength(
   const PyObjPtr& args,
   Index expected
@@ -32,6 +55,23 @@ void CheckNativeFunctionArgumentsWithExpectedLength(
   }
 }
 
+void CheckNativeFunctionArgumentCount(Index nargs, Index expected) {
+  if (nargs != expected) {
+    auto errorMessage = StringConcat(
+      PyList::Create<Object::PyObjPtr>(
+        {PyString::Create(
+           "Check Native Function Arguments With Expected Length: "
+         ),
+         PyInteger::Create(expected)->str(),
+         PyString::Create(" Expected, but got "),
+         PyInteger::Create(nargs)->str()}
+      )
+    );
+    throw std::runtime_error(errorMessage->str()->as<PyString>()->ToCppString()
+    );
+  }
+}
+
 void CheckNativeFunctionArguments(const PyObjPtr& args) {
   if (args->is(ListKlass::Self())) {
     return;
@@ -89,7 +129,7 @@ PyObjPtr NativeFunctionKlass::repr(const PyObjPtr& obj) {
   return StringConcat(
     PyList::Create<Object::PyObjPtr>(
       {PyString::Create("<built-in function at "),
-       Function::Identity(PyList::Create({obj}))->as<PyString>(),
+       Function::Identity(nullptr, &obj, 1)->as<PyString>(),
        PyString::Create(">")}
     )
   );
@@ -6,8 +6,19 @@
 
 namespace kaubo::Object {
 
+/**
+ * @brief 列表调用约定：全部参数装在一个 PyList 里传入
+ */
 using TypeFunction = std::function<PyObjPtr(PyObjPtr)>;
 
+/**
+ * @brief 向量调用约定：参数是调用方连续存放的 nargs 个对象
+ * @details self 是方法调用时绑定的对象，普通调用时为 nullptr。
+ * args 通常直接指向调用方的操作数栈，只在本次调用期间有效
+ */
+using VectorFunction =
+  PyObjPtr (*)(const PyObjPtr& self, const PyObjPtr* args, Index nargs);
+
 class NativeFunctionKlass : public KlassBase<NativeFunctionKlass> {
  public:
   explicit NativeFunctionKlass() = default;
@@ -20,18 +31,34 @@ class PyNativeFunction : public PyObject,
                          public IObjectCreator<PyNativeFunction> {
  private:
   TypeFunction nativeFunction;
+  VectorFunction vectorFunction = nullptr;
 
  public:
+  using KlassType = NativeFunctionKlass;
+
   explicit PyNativeFunction(TypeFunction nativeFunction)
     : PyObject(NativeFunctionKlass::Self()),
       nativeFunction(std::move(nativeFunction)) {}
 
+  explicit PyNativeFunction(VectorFunction vectorFunction)
+    : PyObject(NativeFunctionKlass::Self()), vectorFunction(vectorFunction) {}
+
+  /**
+   * @brief 以列表调用约定调用，方法调用的 self 已放在列表首位
+   */
   PyObjPtr Call(const PyObjPtr& args);
+
+  /**
+   * @brief 以向量调用约定调用
+   * @details 只提供列表接口的函数在这里把 self 和参数装成列表再调用
+   */
+  PyObjPtr Call(const PyObjPtr& self, const PyObjPtr* args, Index nargs);
 };
 
-using PyNativeFunctionPtr = std::shared_ptr<PyNativeFunction>;
+using PyNativeFunctionPtr = Ref<PyNativeFunction>;
 
 void CheckNativeFunctionArguments(const PyObjPtr& args);
+void CheckNativeFunctionArgumentCount(Index nargs, Index expected);
 void CheckNativeFunctionArgumentsWithExpectedLength(
   const PyObjPtr& args,
   Index expected
@@ -23,6 +23,8 @@ class IterDoneKlass : public KlassBase<IterDoneKlass> {
 
 class IterDone : public PyObject {
  public:
+  using KlassType = IterDoneKlass;
+
   explicit IterDone() : PyObject(IterDoneKlass::Self()) {}
 };
 
@@ -65,7 +67,7 @@ class ListReverseIteratorKlass : public KlassBase<ListReverseIteratorKlass> {
 };
 
 inline PyObjPtr CreateIterDone() {
-  return std::make_shared<IterDone>();
+  return MakeRef<IterDone>();
 }
 
 class ListIterator : public PyObject {
@@ -74,6 +76,8 @@ class ListIterator : public PyObject {
   Index index{};
 
  public:
+  using KlassType = ListIteratorKlass;
+
   explicit ListIterator(const PyObjPtr& list)
     : PyObject(ListIteratorKlass::Self()) {
     this->list = list->as<PyList>();
@@ -84,7 +88,7 @@ class ListIterator : public PyObject {
 };
 
 inline PyObjPtr CreateListIterator(const PyObjPtr& list) {
-  return std::make_shared<ListIterator>(list);
+  return MakeRef<ListIterator>(list);
 }
 
 class ListReverseIterator : public PyObject {
@@ -93,6 +97,8 @@ class ListReverseIterator : public PyObject {
   Index index{};
 
  public:
+  using KlassType = ListReverseIteratorKlass;
+
   explicit ListReverseIterator(const PyObjPtr& list)
     : PyObject(ListReverseIteratorKlass::Self()),
       list(list->as<PyList>()),
@@ -121,7 +127,7 @@ class StringIteratorKlass : public KlassBase<StringIteratorKlass> {
 };
 
 inline PyObjPtr CreateListReverseIterator(const PyObjPtr& list) {
-  return std::make_shared<ListReverseIterator>(list);
+  return MakeRef<ListReverseIterator>(list);
 }
 
 class StringIterator : public PyObject {
@@ -130,6 +136,8 @@ class StringIterator : public PyObject {
   Index index{};
 
  public:
+  using KlassType = StringIteratorKlass;
+
   explicit StringIterator(const PyObjPtr& string)
     : PyObject(StringIteratorKlass::Self()) {
     this->string = string->as<PyString>();
@@ -140,7 +148,7 @@ class StringIterator : public PyObject {
 };
 
 inline PyObjPtr CreateStringIterator(const PyObjPtr& string) {
-  return std::make_shared<StringIterator>(string);
+  return MakeRef<StringIterator>(string);
 }
 
 class DictItemIteratorKlass : public KlassBase<DictItemIteratorKlass> {
@@ -166,6 +174,8 @@ class DictItemIterator : public PyObject {
   Index index{};
 
  public:
+  using KlassType = DictItemIteratorKlass;
+
   explicit DictItemIterator(PyDictPtr dict)
     : PyObject(DictItemIteratorKlass::Self()), dict(std::move(dict)) {}
   [[nodiscard]] PyDictPtr Dict() const { return dict; }
@@ -174,7 +184,7 @@ class DictItemIterator : public PyObject {
 };
 
 inline PyObjPtr CreateDictItemIterator(const PyDictPtr& dict) {
-  return std::make_shared<DictItemIterator>(dict);
+  return MakeRef<DictItemIterator>(dict);
 }
 
 }  // namespace kaubo::Object
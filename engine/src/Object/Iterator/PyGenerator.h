@@ -19,17 +19,19 @@ class GeneratorKlass : public KlassBase<GeneratorKlass> {
 };
 
 class PyGenerator;
-using PyGeneratorPtr = std::shared_ptr<PyGenerator>;
+using PyGeneratorPtr = Ref<PyGenerator>;
 
-class PyGenerator : public PyObject, public IObjectCreator<PyGenerator> {
+class PyGenerator : public PyContainer, public IObjectCreator<PyGenerator> {
  private:
   PyFramePtr frame;
   bool isExhausted{};
   std::function<PyObjPtr(const PyGeneratorPtr&)> func;
 
  public:
+  using KlassType = GeneratorKlass;
+
   explicit PyGenerator(PyFramePtr _frame)
-    : PyObject(GeneratorKlass::Self()), frame(std::move(_frame)) {
+    : PyContainer(GeneratorKlass::Self()), frame(std::move(_frame)) {
     func = [](const PyGeneratorPtr& self) -> PyObjPtr {
       auto lastFrame = Runtime::VirtualMachine::Instance().CurrentFrame();
       Runtime::VirtualMachine::Instance().SetFrame(self->frame);
@@ -45,10 +47,13 @@ class PyGenerator : public PyObject, public IObjectCreator<PyGenerator> {
   }
 
   explicit PyGenerator(std::function<PyObjPtr(const PyGeneratorPtr&)> _func)
-    : PyObject(GeneratorKlass::Self()),
+    : PyContainer(GeneratorKlass::Self()),
 
       func(std::move(_func)) {}
   [[nodiscard]] PyFramePtr Frame() const { return frame; }
+  // func 可能按值捕获对象，无法遍历，这些引用都按外部引用处理
+  void Traverse(GcVisitor& visitor) override { visitor.Visit(frame); }
+  void ClearReferences() override { frame = nullptr; }
   [[nodiscard]] bool IsExhausted() const { return isExhausted; }
   void SetExhausted() { isExhausted = true; }
   PyObjPtr Send(const PyObjPtr& value) {
@@ -59,7 +64,7 @@ class PyGenerator : public PyObject, public IObjectCreator<PyGenerator> {
       frame->StackPush(value);  // 先压栈
     }
 
-    return func(shared_from_this()->as<PyGenerator>());
+    return func(as<PyGenerator>());
   }
 
   PyObjPtr Next() { return Send(PyNone::Create()); }
@@ -5,10 +5,13 @@
 #include "Object/Number/PyFloat.h"
 
 namespace kaubo::Object {
-PyObjPtr Array(const PyObjPtr& args) {
-  CheckNativeFunctionArgumentsWithExpectedLength(args, 1);
-  auto argList = args->as<PyList>();
-  auto arg = argList->GetItem(0);
+PyObjPtr Array(
+  const PyObjPtr& /*self*/,
+  const PyObjPtr* args,
+  Index nargs
+) {
+  CheckNativeFunctionArgumentCount(nargs, 1);
+  const auto& arg = args[0];
   if (arg->is(ListKlass::Self())) {
     auto list = arg->as<PyList>();
     auto rows = list->Length();
@@ -48,29 +51,27 @@ PyObjPtr Array(const PyObjPtr& args) {
   );
 }
 
-PyObjPtr Eye(const PyObjPtr& args) {
-  if (!args->is(ListKlass::Self())) {
-    throw std::runtime_error("Eye(): args is not a list");
-  }
-  auto argList = args->as<PyList>();
-
-  if (argList->Length() != 1) {
+PyObjPtr Eye(
+  const PyObjPtr& /*self*/,
+  const PyObjPtr* args,
+  Index nargs
+) {
+  if (nargs != 1) {
     throw std::runtime_error("Eye(): args length is not 1");
   }
-  auto dim = argList->GetItem(0)->as<PyInteger>()->ToU64();
+  auto dim = args[0]->as<PyInteger>()->ToU64();
   return PyMatrix::Create(Collections::Matrix::Eye(dim));
 }
 
-PyObjPtr Zeros(const PyObjPtr& args) {
-  if (!args->is(ListKlass::Self())) {
-    throw std::runtime_error("Zeros(): args is not a list");
-  }
-  auto argList = args->as<PyList>();
-
-  if (argList->Length() != 1) {
+PyObjPtr Zeros(
+  const PyObjPtr& /*self*/,
+  const PyObjPtr* args,
+  Index nargs
+) {
+  if (nargs != 1) {
     throw std::runtime_error("Zeros(): args length is not 1");
   }
-  auto shape = argList->GetItem(0)->as<PyList>();
+  auto shape = args[0]->as<PyList>();
   if (shape->Length() != 2) {
     throw std::runtime_error("Zeros(): shape length is not 2");
   }
@@ -80,16 +81,15 @@ PyObjPtr Zeros(const PyObjPtr& args) {
   return PyMatrix::Create(Collections::Matrix(rows, cols, data));
 }
 
-PyObjPtr Ones(const PyObjPtr& args) {
-  if (!args->is(ListKlass::Self())) {
-    throw std::runtime_error("Ones(): args is not a list");
-  }
-  auto argList = args->as<PyList>();
-
-  if (argList->Length() != 1) {
+PyObjPtr Ones(
+  const PyObjPtr& /*self*/,
+  const PyObjPtr* args,
+  Index nargs
+) {
+  if (nargs != 1) {
     throw std::runtime_error("Ones(): args length is not 1");
   }
-  auto shape = argList->GetItem(0)->as<PyList>();
+  auto shape = args[0]->as<PyList>();
   if (shape->Length() != 2) {
     throw std::runtime_error("Ones(): shape length is not 2");
   }
@@ -99,16 +99,15 @@ PyObjPtr Ones(const PyObjPtr& args) {
   return PyMatrix::Create(Collections::Matrix(rows, cols, data));
 }
 
-PyObjPtr Diagnostic(const PyObjPtr& args) {
-  if (!args->is(ListKlass::Self())) {
-    throw std::runtime_error("Diagnostic(): args is not a list");
-  }
-  auto argList = args->as<PyList>();
-
-  if (argList->Length() != 1) {
+PyObjPtr Diagnostic(
+  const PyObjPtr& /*self*/,
+  const PyObjPtr* args,
+  Index nargs
+) {
+  if (nargs != 1) {
     throw std::runtime_error("Diagnostic(): args length is not 1");
   }
-  auto arg0 = argList->GetItem(0);
+  const auto& arg0 = args[0];
   if (!arg0->is(ListKlass::Self())) {
     throw std::runtime_error("Diagnostic(): arg0 is not a list");
   }
@@ -125,24 +124,25 @@ PyObjPtr Diagnostic(const PyObjPtr& args) {
   return PyMatrix::Create(Collections::Matrix(dim, dim, data));
 }
 
-PyObjPtr Shape(const PyObjPtr& args) {
-  if (!args->is(ListKlass::Self())) {
-    throw std::runtime_error("Shape(): args is not a list");
+PyObjPtr Shape(
+  const PyObjPtr& /*self*/,
+  const PyObjPtr* args,
+  Index nargs
+) {
+  if (nargs != 1) {
+    throw std::runtime_error("Shape(): args length is not 1");
   }
-  return args->as<PyList>()->GetItem(0)->as<PyMatrix>()->Shape();
+  return args[0]->as<PyMatrix>()->Shape();
 }
 
-PyObjPtr Reshape(const PyObjPtr& args) {
-  if (!args->is(ListKlass::Self())) {
-    throw std::runtime_error("Reshape(): args is not a list");
-  }
-  auto argList = args->as<PyList>();
-
-  if (argList->Length() != 2) {
+PyObjPtr Reshape(const PyObjPtr& self, const PyObjPtr* args, Index nargs) {
+  // 作为 matrix.reshape 方法调用时矩阵由 self 传入，否则是第一个参数
+  const bool bound = self != nullptr;
+  if (nargs + (bound ? 1 : 0) != 2) {
     throw std::runtime_error("Reshape(): args length is not 2");
   }
-  auto matrix = argList->GetItem(0)->as<PyMatrix>();
-  auto list = argList->GetItem(1)->as<PyList>();
+  auto matrix = (bound ? self : args[0])->as<PyMatrix>();
+  auto list = args[bound ? 0 : 1]->as<PyList>();
   if (list->Length() != 2) {
     throw std::runtime_error("Reshape(): list length is not 2");
   }
@@ -151,16 +151,12 @@ PyObjPtr Reshape(const PyObjPtr& args) {
   return matrix->Reshape(rows, cols);
 }
 
-PyObjPtr Ravel(const PyObjPtr& args) {
-  if (!args->is(ListKlass::Self())) {
-    throw std::runtime_error("Ravel(): args is not a list");
-  }
-  auto argList = args->as<PyList>();
-
-  if (argList->Length() != 1) {
+PyObjPtr Ravel(const PyObjPtr& self, const PyObjPtr* args, Index nargs) {
+  const bool bound = self != nullptr;
+  if (nargs + (bound ? 1 : 0) != 1) {
     throw std::runtime_error("Ravel(): args length is not 1");
   }
-  auto matrix = argList->GetItem(0)->as<PyMatrix>();
+  auto matrix = (bound ? self : args[0])->as<PyMatrix>();
   auto data = matrix->Ravel();
   Collections::List<PyObjPtr> result(data.Size());
   for (Index i = 0; i < data.Size(); i++) {
@@ -169,15 +165,15 @@ PyObjPtr Ravel(const PyObjPtr& args) {
   return PyList::Create(result);
 }
 
-PyObjPtr Concatenate(const PyObjPtr& args) {
-  if (!args->is(ListKlass::Self())) {
-    throw std::runtime_error("Concatenate(): args is not a list");
-  }
-  auto argList = args->as<PyList>();
-  if (argList->Length() != 1) {
+PyObjPtr Concatenate(
+  const PyObjPtr& /*self*/,
+  const PyObjPtr* args,
+  Index nargs
+) {
+  if (nargs != 1) {
     throw std::runtime_error("Concatenate(): args length is not 1");
   }
-  auto matrixList = argList->GetItem(0)->as<PyList>();
+  auto matrixList = args[0]->as<PyList>();
   auto firstMatrix = matrixList->GetItem(0)->as<PyMatrix>();
   auto cols = firstMatrix->Shape()->GetItem(1)->as<PyInteger>()->ToU64();
   Collections::List<double> data;
@@ -192,11 +188,16 @@ PyObjPtr Concatenate(const PyObjPtr& args) {
   return PyMatrix::Create(Collections::Matrix(rows, cols, data));
 }
 
-PyObjPtr Transpose(const PyObjPtr& args) {
-  CheckNativeFunctionArgumentsWithExpectedLength(args, 1);
-  CheckNativeFunctionArgumentsAtIndexWithType(
-    PyString::Create("Transpose")->as<PyString>(), args, 0, MatrixKlass::Self()
+PyObjPtr Transpose(
+  const PyObjPtr& /*self*/,
+  const PyObjPtr* args,
+  Index nargs
+) {
+  CheckNativeFunctionArgumentCount(nargs, 1);
+  CheckNativeFunctionArgumentWithType(
+    PyString::Create("Transpose")->as<PyString>(), args[0], 0,
+    MatrixKlass::Self()
   );
-  return args->as<PyList>()->GetItem(0)->as<PyMatrix>()->Transpose();
+  return args[0]->as<PyMatrix>()->Transpose();
 }
 }  // namespace kaubo::Object
\ No newline at end of file
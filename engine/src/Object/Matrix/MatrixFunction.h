@@ -3,24 +3,65 @@
 #include "Object/Core/PyObject.h"
 
 namespace kaubo::Object {
+// 矩阵相关的内置函数，采用向量调用约定，见 VectorFunction
 
-PyObjPtr Transpose(const PyObjPtr& args);
+PyObjPtr Transpose(
+  const PyObjPtr& self,
+  const PyObjPtr* args,
+  Index nargs
+);
 
-PyObjPtr Array(const PyObjPtr& args);
+PyObjPtr Array(
+  const PyObjPtr& self,
+  const PyObjPtr* args,
+  Index nargs
+);
 
-PyObjPtr Eye(const PyObjPtr& args);
+PyObjPtr Eye(
+  const PyObjPtr& self,
+  const PyObjPtr* args,
+  Index nargs
+);
 
-PyObjPtr Zeros(const PyObjPtr& args);
+PyObjPtr Zeros(
+  const PyObjPtr& self,
+  const PyObjPtr* args,
+  Index nargs
+);
 
-PyObjPtr Ones(const PyObjPtr& args);
+PyObjPtr Ones(
+  const PyObjPtr& self,
+  const PyObjPtr* args,
+  Index nargs
+);
 
-PyObjPtr Diagnostic(const PyObjPtr& args);
+PyObjPtr Diagnostic(
+  const PyObjPtr& self,
+  const PyObjPtr* args,
+  Index nargs
+);
 
-PyObjPtr Reshape(const PyObjPtr& args);
+PyObjPtr Reshape(
+  const PyObjPtr& self,
+  const PyObjPtr* args,
+  Index nargs
+);
 
-PyObjPtr Shape(const PyObjPtr& args);
+PyObjPtr Shape(
+  const PyObjPtr& self,
+  const PyObjPtr* args,
+  Index nargs
+);
 
-PyObjPtr Concatenate(const PyObjPtr& args);
+PyObjPtr Concatenate(
+  const PyObjPtr& self,
+  const PyObjPtr* args,
+  Index nargs
+);
 
-PyObjPtr Ravel(const PyObjPtr& args);
+PyObjPtr Ravel(
+  const PyObjPtr& self,
+  const PyObjPtr* args,
+  Index nargs
+);
 }  // namespace kaubo::Object
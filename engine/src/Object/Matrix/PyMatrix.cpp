@@ -319,12 +319,8 @@ PyObjPtr MatrixKlass::pow(const PyObjPtr& lhs, const PyObjPtr& rhs) {
   if (power < 0) {
     throw std::runtime_error("MatrixKlass::pow(): n is less than 0");
   }
-  auto result = Eye(
-                  PyList::Create<Object::PyObjPtr>(
-                    {lhs->as<PyMatrix>()->Shape()->GetItem(0)}
-                  )
-  )
-                  ->as<PyMatrix>();
+  auto dim = matrix->Shape()->GetItem(0);
+  auto result = Eye(nullptr, &dim, 1)->as<PyMatrix>();
   // 快速幂算法
   while (power != 0) {
     if ((power & 1ULL) != 0) {
@@ -343,10 +339,18 @@ void MatrixKlass::Initialize() {
   auto* instance = Self();
   InitKlass(PyString::Create("matrix")->as<PyString>(), instance);
   instance->AddAttribute(
-    PyString::Create("T")->as<PyString>(), PyIife::Create(Transpose)
+    PyString::Create("T")->as<PyString>(),
+    PyIife::Create([](const PyObjPtr& args) {
+      auto list = args->as<PyList>();
+      return Transpose(nullptr, list->Data(), list->Length());
+    })
   );
   instance->AddAttribute(
-    PyString::Create("shape")->as<PyString>(), PyIife::Create(Shape)
+    PyString::Create("shape")->as<PyString>(),
+    PyIife::Create([](const PyObjPtr& args) {
+      auto list = args->as<PyList>();
+      return Shape(nullptr, list->Data(), list->Length());
+    })
   );
   instance->AddAttribute(
     PyString::Create("reshape")->as<PyString>(),
@@ -47,7 +47,7 @@ class MatrixKlass : public KlassBase<MatrixKlass> {
 };
 
 class PyMatrix;
-using PyMatrixPtr = std::shared_ptr<PyMatrix>;
+using PyMatrixPtr = Ref<PyMatrix>;
 
 class PyMatrix : public PyObject, public IObjectCreator<PyMatrix> {
   friend class MatrixKlass;
@@ -56,6 +56,8 @@ class PyMatrix : public PyObject, public IObjectCreator<PyMatrix> {
   Collections::Matrix matrix;
 
  public:
+  using KlassType = MatrixKlass;
+
   explicit PyMatrix(Collections::Matrix matrix)
     : PyObject(MatrixKlass::Self()), matrix(std::move(matrix)) {}
 
@@ -132,8 +134,11 @@ class PyMatrix : public PyObject, public IObjectCreator<PyMatrix> {
   void Set(Index row, Index col, double value) { matrix.Set(row, col, value); }
 
   const Collections::List<double>& Ravel() const { return matrix.Data(); }
+  [[nodiscard]] Index MemoryFootprint() const override {
+    return sizeof(PyMatrix) + matrix.Data().HeapBytes();
+  }
 };
 
-using PyMatrixPtr = std::shared_ptr<PyMatrix>;
+using PyMatrixPtr = Ref<PyMatrix>;
 
 }  // namespace kaubo::Object
@@ -42,7 +42,8 @@ PyObjPtr FloatKlass::add(const PyObjPtr& lhs, const PyObjPtr& rhs) {
     throw std::runtime_error("PyFloat::add(): lhs or rhs is not a float");
   }
   return PyFloat::Create(
-    lhs->as<PyFloat>()->Value() + rhs->as<PyFloat>()->Value()
+    lhs->unchecked_as<PyFloat>()->Value() +
+    rhs->unchecked_as<PyFloat>()->Value()
   );
 }
 
@@ -51,7 +52,8 @@ PyObjPtr FloatKlass::sub(const PyObjPtr& lhs, const PyObjPtr& rhs) {
     throw std::runtime_error("PyFloat::sub(): lhs or rhs is not a float");
   }
   return PyFloat::Create(
-    lhs->as<PyFloat>()->Value() - rhs->as<PyFloat>()->Value()
+    lhs->unchecked_as<PyFloat>()->Value() -
+    rhs->unchecked_as<PyFloat>()->Value()
   );
 }
 
@@ -61,13 +63,14 @@ PyObjPtr FloatKlass::mul(const PyObjPtr& lhs, const PyObjPtr& rhs) {
   }
   if (rhs->is(Self())) {
     return PyFloat::Create(
-      lhs->as<PyFloat>()->Value() * rhs->as<PyFloat>()->Value()
+      lhs->unchecked_as<PyFloat>()->Value() *
+      rhs->unchecked_as<PyFloat>()->Value()
     );
   }
   if (rhs->is(IntegerKlass::Self())) {
     return PyFloat::Create(
-      lhs->as<PyFloat>()->Value() *
-      static_cast<double>(rhs->as<PyInteger>()->ToU64())
+      lhs->unchecked_as<PyFloat>()->Value() *
+      static_cast<double>(rhs->unchecked_as<PyInteger>()->ToU64())
     );
   }
   throw std::runtime_error("PyFloat::mul(): rhs is not a float or int");
@@ -78,7 +81,8 @@ PyObjPtr FloatKlass::truediv(const PyObjPtr& lhs, const PyObjPtr& rhs) {
     throw std::runtime_error("PyFloat::div(): lhs or rhs is not a float");
   }
   return PyFloat::Create(
-    lhs->as<PyFloat>()->Value() / rhs->as<PyFloat>()->Value()
+    lhs->unchecked_as<PyFloat>()->Value() /
+    rhs->unchecked_as<PyFloat>()->Value()
   );
 }
 
@@ -87,7 +91,10 @@ PyObjPtr FloatKlass::floordiv(const PyObjPtr& lhs, const PyObjPtr& rhs) {
     throw std::runtime_error("PyFloat::floordiv(): lhs or rhs is not a float");
   }
   return PyFloat::Create(
-    std::floor(lhs->as<PyFloat>()->Value() / rhs->as<PyFloat>()->Value())
+    std::floor(
+      lhs->unchecked_as<PyFloat>()->Value() /
+      rhs->unchecked_as<PyFloat>()->Value()
+    )
   );
 }
 
@@ -96,7 +103,10 @@ PyObjPtr FloatKlass::mod(const PyObjPtr& lhs, const PyObjPtr& rhs) {
     throw std::runtime_error("PyFloat::mod(): lhs or rhs is not a float");
   }
   return PyFloat::Create(
-    std::fmod(lhs->as<PyFloat>()->Value(), rhs->as<PyFloat>()->Value())
+    std::fmod(
+      lhs->unchecked_as<PyFloat>()->Value(),
+      rhs->unchecked_as<PyFloat>()->Value()
+    )
   );
 }
 
@@ -105,7 +115,10 @@ PyObjPtr FloatKlass::pow(const PyObjPtr& lhs, const PyObjPtr& rhs) {
     throw std::runtime_error("PyFloat::pow(): lhs or rhs is not a float");
   }
   return PyFloat::Create(
-    std::pow(lhs->as<PyFloat>()->Value(), rhs->as<PyFloat>()->Value())
+    std::pow(
+      lhs->unchecked_as<PyFloat>()->Value(),
+      rhs->unchecked_as<PyFloat>()->Value()
+    )
   );
 }
 
@@ -115,7 +128,7 @@ PyObjPtr FloatKlass::hash(const PyObjPtr& obj) {
   }
   return PyInteger::Create(
     Collections::CreateIntegerWithU64(
-      static_cast<uint64_t>(obj->as<PyFloat>()->Value())
+      static_cast<uint64_t>(obj->unchecked_as<PyFloat>()->Value())
     )
   );
 }
@@ -124,14 +137,14 @@ PyObjPtr FloatKlass::neg(const PyObjPtr& obj) {
   if (!obj->is(Self())) {
     throw std::runtime_error("PyFloat::neg(): obj is not a float");
   }
-  return PyFloat::Create(-obj->as<PyFloat>()->Value());
+  return PyFloat::Create(-obj->unchecked_as<PyFloat>()->Value());
 }
 
 PyObjPtr FloatKlass::repr(const PyObjPtr& obj) {
   if (!obj->is(Self())) {
     throw std::runtime_error("PyFloat::repr(): obj is not a float");
   }
-  auto floatObj = obj->as<PyFloat>();
+  auto floatObj = obj->unchecked_as<PyFloat>();
   return PyString::Create(Collections::ToString(floatObj->Value()));
 }
 
@@ -139,7 +152,7 @@ PyObjPtr FloatKlass::_serialize_(const PyObjPtr& obj) {
   if (!obj->is(Self())) {
     throw std::runtime_error("PyFloat::_serialize_(): obj is not a float");
   }
-  auto floatObj = obj->as<PyFloat>();
+  auto floatObj = obj->unchecked_as<PyFloat>();
   Collections::StringBuilder stringBuilder(
     Collections::Serialize(Literal::FLOAT)
   );
@@ -152,7 +165,8 @@ PyObjPtr FloatKlass::eq(const PyObjPtr& lhs, const PyObjPtr& rhs) {
     throw std::runtime_error("PyFloat::eq(): lhs or rhs is not a float");
   }
   return PyBoolean::Create(
-    lhs->as<PyFloat>()->Value() == rhs->as<PyFloat>()->Value()
+    lhs->unchecked_as<PyFloat>()->Value() ==
+    rhs->unchecked_as<PyFloat>()->Value()
   );
 }
 
@@ -161,7 +175,8 @@ PyObjPtr FloatKlass::lt(const PyObjPtr& lhs, const PyObjPtr& rhs) {
     throw std::runtime_error("PyFloat::lt(): lhs or rhs is not a float");
   }
   return PyBoolean::Create(
-    lhs->as<PyFloat>()->Value() < rhs->as<PyFloat>()->Value()
+    lhs->unchecked_as<PyFloat>()->Value() <
+    rhs->unchecked_as<PyFloat>()->Value()
   );
 }
 
@@ -169,7 +184,7 @@ PyObjPtr FloatKlass::boolean(const PyObjPtr& obj) {
   if (!obj->is(Self())) {
     throw std::runtime_error("PyFloat::boolean(): obj is not a float");
   }
-  return PyBoolean::Create(obj->as<PyFloat>()->Value() != 0.0);
+  return PyBoolean::Create(obj->unchecked_as<PyFloat>()->Value() != 0.0);
 }
 
 }  // namespace kaubo::Object
@@ -44,10 +44,15 @@ class PyFloat : public PyObject, public IObjectCreator<PyFloat> {
   double value;
 
  public:
+  using KlassType = FloatKlass;
+
   explicit PyFloat(double value) : PyObject(FloatKlass::Self()), value(value) {}
 
   [[nodiscard]] double Value() const { return value; }
+  [[nodiscard]] Index MemoryFootprint() const override {
+    return sizeof(PyFloat);
+  }
 };
-using PyFloatPtr = std::shared_ptr<PyFloat>;
+using PyFloatPtr = Ref<PyFloat>;
 
 }  // namespace kaubo::Object
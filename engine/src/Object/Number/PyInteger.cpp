@@ -9,8 +9,187 @@
 #include "Object/String/PyBytes.h"
 #include "Object/String/PyString.h"
 
+#include <limits>
+
 namespace kaubo::Object {
 
+namespace {
+
+// 带溢出检查的 int64_t 运算，溢出时返回 true，result 不可用
+bool AddOverflow(int64_t lhs, int64_t rhs, int64_t& result) {
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_add_overflow(lhs, rhs, &result);
+#else
+  if ((rhs > 0 && lhs > std::numeric_limits<int64_t>::max() - rhs) ||
+      (rhs < 0 && lhs < std::numeric_limits<int64_t>::min() - rhs)) {
+    return true;
+  }
+  result = lhs + rhs;
+  return false;
+#endif
+}
+
+bool SubtractOverflow(int64_t lhs, int64_t rhs, int64_t& result) {
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_sub_overflow(lhs, rhs, &result);
+#else
+  if ((rhs < 0 && lhs > std::numeric_limits<int64_t>::max() + rhs) ||
+      (rhs > 0 && lhs < std::numeric_limits<int64_t>::min() + rhs)) {
+    return true;
+  }
+  result = lhs - rhs;
+  return false;
+#endif
+}
+
+bool MultiplyOverflow(int64_t lhs, int64_t rhs, int64_t& result) {
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_mul_overflow(lhs, rhs, &result);
+#else
+  if (lhs == 0 || rhs == 0) {
+    result = 0;
+    return false;
+  }
+  constexpr auto max = std::numeric_limits<int64_t>::max();
+  constexpr auto min = std::numeric_limits<int64_t>::min();
+  if ((lhs == -1 && rhs == min) || (rhs == -1 && lhs == min)) {
+    return true;
+  }
+  if ((lhs > 0 && rhs > 0 && lhs > max / rhs) ||
+      (lhs < 0 && rhs < 0 && lhs < max / rhs) ||
+      (lhs > 0 && rhs < 0 && rhs < min / lhs) ||
+      (lhs < 0 && rhs > 0 && lhs < min / rhs)) {
+    return true;
+  }
+  result = lhs * rhs;
+  return false;
+#endif
+}
+
+constexpr int64_t SMALL_INT_MIN = KAUBO_SMALL_INT_MIN;
+constexpr int64_t SMALL_INT_MAX = KAUBO_SMALL_INT_MAX;
+static_assert(SMALL_INT_MIN <= 0 && SMALL_INT_MAX >= 0);
+
+SmallIntegerCacheStats smallIntegerStats{0, 0};
+
+// 小整数表在第一次创建整数时建好，之后常驻：故意不释放，
+// 这样进程退出时也不会和其他静态对象的析构顺序纠缠
+const PyIntPtr* SmallIntegers() {
+  static const PyIntPtr* table = [] {
+    auto* integers = new PyIntPtr[SMALL_INT_MAX - SMALL_INT_MIN + 1];
+    for (int64_t value = SMALL_INT_MIN; value <= SMALL_INT_MAX; value++) {
+      integers[value - SMALL_INT_MIN] = MakeRef<PyInteger>(value);
+    }
+    return integers;
+  }();
+  return table;
+}
+
+}  // namespace
+
+PyIntPtr PyInteger::Create(int64_t value) {
+  if (value >= SMALL_INT_MIN && value <= SMALL_INT_MAX) {
+    smallIntegerStats.hits++;
+    return SmallIntegers()[value - SMALL_INT_MIN];
+  }
+  smallIntegerStats.misses++;
+  return MakeRef<PyInteger>(value);
+}
+
+PyIntPtr PyInteger::Create(uint64_t value) {
+  if (value <= static_cast<uint64_t>(SMALL_INT_MAX)) {
+    smallIntegerStats.hits++;
+    return SmallIntegers()[static_cast<int64_t>(value) - SMALL_INT_MIN];
+  }
+  smallIntegerStats.misses++;
+  return MakeRef<PyInteger>(value);
+}
+
+PyIntPtr PyInteger::Create(Collections::Integer value) {
+  int64_t inlined = 0;
+  if (Collections::TryToI64(value, inlined)) {
+    return Create(inlined);
+  }
+  smallIntegerStats.misses++;
+  return MakeRef<PyInteger>(std::move(value));
+}
+
+SmallIntegerCacheStats GetSmallIntegerCacheStats() {
+  return smallIntegerStats;
+}
+
+PyInteger::PyInteger(Collections::Integer value)
+  : PyObject(IntegerKlass::Self()) {
+  if (!Collections::TryToI64(value, small)) {
+    big = std::move(value);
+    isSmall = false;
+  }
+}
+
+PyInteger::PyInteger(uint64_t value) : PyObject(IntegerKlass::Self()) {
+  if (value <= static_cast<uint64_t>(std::numeric_limits<int64_t>::max())) {
+    small = static_cast<int64_t>(value);
+  } else {
+    big = Collections::CreateIntegerWithU64(value);
+    isSmall = false;
+  }
+}
+
+Collections::Integer PyInteger::Value() const {
+  return isSmall ? Collections::CreateIntegerWithI64(small) : big;
+}
+
+Index PyInteger::ToU64() const {
+  if (!isSmall) {
+    return Collections::ToU64(big);
+  }
+  if (small < 0) {
+    throw std::runtime_error("Negative integer cannot be converted to index");
+  }
+  return static_cast<Index>(small);
+}
+
+PyObjPtr IntegerAdd(const PyInteger& lhs, const PyInteger& rhs) {
+  int64_t result = 0;
+  if (lhs.IsSmall() && rhs.IsSmall() &&
+      !AddOverflow(lhs.SmallValue(), rhs.SmallValue(), result)) {
+    return PyInteger::Create(result);
+  }
+  return PyInteger::Create(lhs.Value().Add(rhs.Value()));
+}
+
+PyObjPtr IntegerSubtract(const PyInteger& lhs, const PyInteger& rhs) {
+  int64_t result = 0;
+  if (lhs.IsSmall() && rhs.IsSmall() &&
+      !SubtractOverflow(lhs.SmallValue(), rhs.SmallValue(), result)) {
+    return PyInteger::Create(result);
+  }
+  return PyInteger::Create(lhs.Value().Subtract(rhs.Value()));
+}
+
+PyObjPtr IntegerMultiply(const PyInteger& lhs, const PyInteger& rhs) {
+  int64_t result = 0;
+  if (lhs.IsSmall() && rhs.IsSmall() &&
+      !MultiplyOverflow(lhs.SmallValue(), rhs.SmallValue(), result)) {
+    return PyInteger::Create(result);
+  }
+  return PyInteger::Create(lhs.Value().Multiply(rhs.Value()));
+}
+
+bool IntegerLessThan(const PyInteger& lhs, const PyInteger& rhs) {
+  if (lhs.IsSmall() && rhs.IsSmall()) {
+    return lhs.SmallValue() < rhs.SmallValue();
+  }
+  return lhs.Value().LessThan(rhs.Value());
+}
+
+bool IntegerEqual(const PyInteger& lhs, const PyInteger& rhs) {
+  if (lhs.IsSmall() && rhs.IsSmall()) {
+    return lhs.SmallValue() == rhs.SmallValue();
+  }
+  return lhs.Value().Equal(rhs.Value());
+}
+
 void IntegerKlass::Initialize() {
   InitKlass(PyString::Create("int")->as<PyString>(), Self());
 }
@@ -51,27 +230,27 @@ PyObjPtr IntegerKlass::add(const PyObjPtr& lhs, const PyObjPtr& rhs) {
   if (!lhs->is(IntegerKlass::Self()) || !rhs->is(IntegerKlass::Self())) {
     throw std::runtime_error("PyInteger::add(): lhs or rhs is not an integer");
   }
-  auto left = lhs->as<PyInteger>();
-  auto right = rhs->as<PyInteger>();
-  return PyInteger::Create(left->value.Add(right->value));
+  return IntegerAdd(
+    *lhs->unchecked_as<PyInteger>(), *rhs->unchecked_as<PyInteger>()
+  );
 }
 
 PyObjPtr IntegerKlass::sub(const PyObjPtr& lhs, const PyObjPtr& rhs) {
   if (!lhs->is(IntegerKlass::Self()) || !rhs->is(IntegerKlass::Self())) {
     throw std::runtime_error("PyInteger::sub(): lhs or rhs is not an integer");
   }
-  auto left = lhs->as<PyInteger>();
-  auto right = rhs->as<PyInteger>();
-  return PyInteger::Create(left->value.Subtract(right->value));
+  return IntegerSubtract(
+    *lhs->unchecked_as<PyInteger>(), *rhs->unchecked_as<PyInteger>()
+  );
 }
 
 PyObjPtr IntegerKlass::mul(const PyObjPtr& lhs, const PyObjPtr& rhs) {
   if (!lhs->is(IntegerKlass::Self()) || !rhs->is(IntegerKlass::Self())) {
     throw std::runtime_error("PyInteger::mul(): lhs or rhs is not an integer");
   }
-  auto left = lhs->as<PyInteger>();
-  auto right = rhs->as<PyInteger>();
-  return PyInteger::Create(left->value.Multiply(right->value));
+  return IntegerMultiply(
+    *lhs->unchecked_as<PyInteger>(), *rhs->unchecked_as<PyInteger>()
+  );
 }
 
 PyObjPtr IntegerKlass::floordiv(const PyObjPtr& lhs, const PyObjPtr& rhs) {
@@ -80,17 +259,22 @@ PyObjPtr IntegerKlass::floordiv(const PyObjPtr& lhs, const PyObjPtr& rhs) {
       "PyInteger::floordiv(): lhs or rhs is not an integer"
     );
   }
-  auto left = lhs->as<PyInteger>();
-  auto right = rhs->as<PyInteger>();
-  return PyInteger::Create(left->value.Divide(right->value));
+  auto left = lhs->unchecked_as<PyInteger>();
+  auto right = rhs->unchecked_as<PyInteger>();
+  // 非负数的整除与截断除法一致，可以直接在内联值上计算
+  if (left->isSmall && right->isSmall && left->small >= 0 &&
+      right->small > 0) {
+    return PyInteger::Create(left->small / right->small);
+  }
+  return PyInteger::Create(left->Value().Divide(right->Value()));
 }
 
 PyObjPtr IntegerKlass::truediv(const PyObjPtr& lhs, const PyObjPtr& rhs) {
   if (!lhs->is(IntegerKlass::Self()) || !rhs->is(IntegerKlass::Self())) {
     throw std::runtime_error("PyInteger::div(): lhs or rhs is not an integer");
   }
-  auto left = static_cast<double>(lhs->as<PyInteger>()->ToU64());
-  auto right = static_cast<double>(rhs->as<PyInteger>()->ToU64());
+  auto left = static_cast<double>(lhs->unchecked_as<PyInteger>()->ToU64());
+  auto right = static_cast<double>(rhs->unchecked_as<PyInteger>()->ToU64());
   return PyFloat::Create(left / right);
 }
 
@@ -98,18 +282,22 @@ PyObjPtr IntegerKlass::mod(const PyObjPtr& lhs, const PyObjPtr& rhs) {
   if (!lhs->is(IntegerKlass::Self()) || !rhs->is(IntegerKlass::Self())) {
     throw std::runtime_error("PyInteger::mod(): lhs or rhs is not an integer");
   }
-  auto left = lhs->as<PyInteger>();
-  auto right = rhs->as<PyInteger>();
-  return PyInteger::Create(left->value.Modulo(right->value));
+  auto left = lhs->unchecked_as<PyInteger>();
+  auto right = rhs->unchecked_as<PyInteger>();
+  if (left->isSmall && right->isSmall && left->small >= 0 &&
+      right->small > 0) {
+    return PyInteger::Create(left->small % right->small);
+  }
+  return PyInteger::Create(left->Value().Modulo(right->Value()));
 }
 
 PyObjPtr IntegerKlass::pow(const PyObjPtr& lhs, const PyObjPtr& rhs) {
   if (!lhs->is(IntegerKlass::Self()) || !rhs->is(IntegerKlass::Self())) {
     throw std::runtime_error("PyInteger::pow(): lhs or rhs is not an integer");
   }
-  auto left = lhs->as<PyInteger>();
-  auto right = rhs->as<PyInteger>();
-  return PyInteger::Create(left->value.Power(right->value));
+  auto left = lhs->unchecked_as<PyInteger>();
+  auto right = rhs->unchecked_as<PyInteger>();
+  return PyInteger::Create(left->Value().Power(right->Value()));
 }
 
 PyObjPtr IntegerKlass::pos(const PyObjPtr& obj) {
@@ -123,23 +311,30 @@ PyObjPtr IntegerKlass::neg(const PyObjPtr& obj) {
   if (!obj->is(IntegerKlass::Self())) {
     throw std::runtime_error("PyInteger::neg(): obj is not an integer");
   }
-  auto integer = obj->as<PyInteger>();
-  return PyInteger::Create(integer->value.Negate());
+  auto integer = obj->unchecked_as<PyInteger>();
+  if (integer->isSmall &&
+      integer->small != std::numeric_limits<int64_t>::min()) {
+    return PyInteger::Create(-integer->small);
+  }
+  return PyInteger::Create(integer->Value().Negate());
 }
 
 PyObjPtr IntegerKlass::boolean(const PyObjPtr& obj) {
   if (!obj->is(IntegerKlass::Self())) {
     throw std::runtime_error("PyInteger::boolean(): obj is not an integer");
   }
-  auto integer = obj->as<PyInteger>();
-  return PyBoolean::Create(!integer->value.IsZero());
+  auto integer = obj->unchecked_as<PyInteger>();
+  if (integer->isSmall) {
+    return PyBoolean::Create(integer->small != 0);
+  }
+  return PyBoolean::Create(!integer->big.IsZero());
 }
 
 PyObjPtr IntegerKlass::hash(const PyObjPtr& obj) {
   if (!obj->is(IntegerKlass::Self())) {
     throw std::runtime_error("PyInteger::hash(): obj is not an integer");
   }
-  if (obj->as<PyInteger>()->IsBigNumber()) {
+  if (obj->unchecked_as<PyInteger>()->IsBigNumber()) {
     return PyInteger::Create(
       Collections::CreateIntegerWithU64(reinterpret_cast<uint64_t>(obj.get()))
     );
@@ -161,17 +356,17 @@ PyObjPtr IntegerKlass::_xor_(const PyObjPtr& lhs, const PyObjPtr& rhs) {
       "PyInteger::_xor_(): lhs or rhs is not an integer"
     );
   }
-  auto left = lhs->as<PyInteger>();
-  auto right = rhs->as<PyInteger>();
-  return PyInteger::Create(left->value.BitWiseXor(right->value));
+  auto left = lhs->unchecked_as<PyInteger>();
+  auto right = rhs->unchecked_as<PyInteger>();
+  return PyInteger::Create(left->Value().BitWiseXor(right->Value()));
 }
 
 PyObjPtr IntegerKlass::invert(const PyObjPtr& obj) {
   if (!obj->is(IntegerKlass::Self())) {
     throw std::runtime_error("PyInteger::invert(): obj is not an integer");
   }
-  auto integer = obj->as<PyInteger>();
-  return PyInteger::Create(integer->value.BitWiseNot());
+  auto integer = obj->unchecked_as<PyInteger>();
+  return PyInteger::Create(integer->Value().BitWiseNot());
 }
 
 PyObjPtr IntegerKlass::lshift(const PyObjPtr& lhs, const PyObjPtr& rhs) {
@@ -180,9 +375,9 @@ PyObjPtr IntegerKlass::lshift(const PyObjPtr& lhs, const PyObjPtr& rhs) {
       "PyInteger::lshift(): lhs or rhs is not an integer"
     );
   }
-  auto left = lhs->as<PyInteger>();
-  auto right = rhs->as<PyInteger>();
-  return PyInteger::Create(left->value.LeftShift(right->value));
+  auto left = lhs->unchecked_as<PyInteger>();
+  auto right = rhs->unchecked_as<PyInteger>();
+  return PyInteger::Create(left->Value().LeftShift(right->Value()));
 }
 
 PyObjPtr IntegerKlass::rshift(const PyObjPtr& lhs, const PyObjPtr& rhs) {
@@ -191,16 +386,19 @@ PyObjPtr IntegerKlass::rshift(const PyObjPtr& lhs, const PyObjPtr& rhs) {
       "PyInteger::rshift(): lhs or rhs is not an integer"
     );
   }
-  auto left = lhs->as<PyInteger>();
-  auto right = rhs->as<PyInteger>();
-  return PyInteger::Create(left->value.RightShift(right->value));
+  auto left = lhs->unchecked_as<PyInteger>();
+  auto right = rhs->unchecked_as<PyInteger>();
+  return PyInteger::Create(left->Value().RightShift(right->Value()));
 }
 PyObjPtr IntegerKlass::repr(const PyObjPtr& obj) {
   if (!obj->is(IntegerKlass::Self())) {
     throw std::runtime_error("PyInteger::repr(): obj is not an integer");
   }
-  auto integer = obj->as<PyInteger>();
-  return PyString::Create((integer->value).ToString());
+  auto integer = obj->unchecked_as<PyInteger>();
+  if (integer->isSmall) {
+    return PyString::Create(Collections::ToString(integer->small));
+  }
+  return PyString::Create(integer->big.ToString());
 }
 PyObjPtr IntegerKlass::str(const PyObjPtr& obj) {
   return repr(obj);
@@ -210,30 +408,34 @@ PyObjPtr IntegerKlass::lt(const PyObjPtr& lhs, const PyObjPtr& rhs) {
   if (!lhs->is(IntegerKlass::Self()) || !rhs->is(IntegerKlass::Self())) {
     throw std::runtime_error("PyInteger::gt(): lhs or rhs is not an integer");
   }
-  auto left = lhs->as<PyInteger>();
-  auto right = rhs->as<PyInteger>();
-  return PyBoolean::Create(left->value.LessThan(right->value));
+  return PyBoolean::Create(
+    IntegerLessThan(
+      *lhs->unchecked_as<PyInteger>(), *rhs->unchecked_as<PyInteger>()
+    )
+  );
 }
 
 PyObjPtr IntegerKlass::eq(const PyObjPtr& lhs, const PyObjPtr& rhs) {
   if (!lhs->is(IntegerKlass::Self()) || !rhs->is(IntegerKlass::Self())) {
     throw std::runtime_error("PyInteger::eq(): lhs or rhs is not an integer");
   }
-  auto left = lhs->as<PyInteger>();
-  auto right = rhs->as<PyInteger>();
-  return PyBoolean::Create(left->value.Equal(right->value));
+  return PyBoolean::Create(
+    IntegerEqual(
+      *lhs->unchecked_as<PyInteger>(), *rhs->unchecked_as<PyInteger>()
+    )
+  );
 }
 
 PyObjPtr IntegerKlass::_serialize_(const PyObjPtr& obj) {
   if (!obj->is(IntegerKlass::Self())) {
     throw std::runtime_error("PyInteger::_serialize_(): obj is not an integer");
   }
-  auto integer = obj->as<PyInteger>();
-  if (integer->value.IsZero()) {
+  auto integer = obj->unchecked_as<PyInteger>();
+  if (integer->isSmall && integer->small == 0) {
     return PyBytes::Create(Collections::Serialize(Literal::ZERO));
   }
   Collections::StringBuilder bytes(Collections::Serialize(Literal::INTEGER));
-  bytes.Append(Collections::Serialize(integer->value));
+  bytes.Append(Collections::Serialize(integer->Value()));
   return PyBytes::Create(bytes.ToString());
 }
 
@@ -241,16 +443,14 @@ bool PyInteger::LessThan(const PyObjPtr& other) const {
   if (!other->is(IntegerKlass::Self())) {
     throw std::runtime_error("PyInteger::LessThan(): other is not an integer");
   }
-  auto otherInteger = other->as<PyInteger>();
-  return value.LessThan(otherInteger->value);
+  return IntegerLessThan(*this, *other->unchecked_as<PyInteger>());
 }
 
 bool PyInteger::Equal(const PyObjPtr& other) const {
   if (!other->is(IntegerKlass::Self())) {
     throw std::runtime_error("PyInteger::Equal(): other is not an integer");
   }
-  auto otherInteger = other->as<PyInteger>();
-  return value.Equal(otherInteger->value);
+  return IntegerEqual(*this, *other->unchecked_as<PyInteger>());
 }
 
 }  // namespace kaubo::Object
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <type_traits>
 #include "Collections/Integer/Integer.h"
 #include "Collections/Integer/IntegerHelper.h"
 #include "Object/Core/IObjectCreator.h"
@@ -8,6 +9,17 @@
 #include "Object/Core/PyObject.h"
 #include "Object/Object.h"
 
+/**
+ * @brief 小整数缓存覆盖的范围，两端都包含
+ * @details 可以在编译时重新定义，例如 -DKAUBO_SMALL_INT_MAX=4096
+ */
+#ifndef KAUBO_SMALL_INT_MIN
+#define KAUBO_SMALL_INT_MIN (-5)
+#endif
+#ifndef KAUBO_SMALL_INT_MAX
+#define KAUBO_SMALL_INT_MAX 1024
+#endif
+
 namespace kaubo::Object {
 
 class IntegerKlass : public KlassBase<IntegerKlass> {
@@ -42,39 +54,117 @@ class IntegerKlass : public KlassBase<IntegerKlass> {
 
 class PyInteger;
 
-using PyIntPtr = std::shared_ptr<PyInteger>;
+using PyIntPtr = Ref<PyInteger>;
 
+/**
+ * @brief 整数对象
+ * @details 能放进 int64_t 的值直接内联存放，不分配大整数的分段；
+ * 只有超出这个范围的值才使用 Collections::Integer。所有构造函数都会
+ * 规范化，所以同一个值总是只有一种表示
+ */
 class PyInteger : public PyObject, public IObjectCreator<PyInteger> {
   friend class IntegerKlass;
 
  private:
-  Collections::Integer value;
+  int64_t small = 0;
+  Collections::Integer big;  // 仅在 isSmall 为 false 时有效
+  bool isSmall = true;
 
  public:
-  explicit PyInteger(Collections::Integer value)
-    : PyObject(IntegerKlass::Self()), value(std::move(value)) {}
+  using KlassType = IntegerKlass;
+
+  explicit PyInteger(Collections::Integer value);
 
-  explicit PyInteger(uint64_t value)
-    : PyInteger(Collections::CreateIntegerWithU64(value)) {}
+  explicit PyInteger(uint64_t value);
 
   explicit PyInteger(int64_t value)
-    : PyInteger(Collections::CreateIntegerWithI64(value)) {}
+    : PyObject(IntegerKlass::Self()), small(value) {}
+
+  /**
+   * @brief 创建整数对象
+   * @details 落在小整数缓存范围内的值直接返回预先建好的常驻对象，
+   * 不再分配。字面量、反序列化出的常量和运行时算出的结果都经过这里，
+   * 所以同一个小整数在整个进程里只有一个对象
+   */
+  static PyIntPtr Create(int64_t value);
+
+  static PyIntPtr Create(uint64_t value);
+
+  static PyIntPtr Create(Collections::Integer value);
+
+  template <
+    typename T,
+    typename = std::enable_if_t<std::is_integral_v<T>>>
+  static PyIntPtr Create(T value) {
+    if constexpr (std::is_signed_v<T>) {
+      return Create(static_cast<int64_t>(value));
+    } else {
+      return Create(static_cast<uint64_t>(value));
+    }
+  }
+
+  /**
+   * @brief 以大整数形式取值，内联存放的值在这里转换一次
+   */
+  [[nodiscard]] Collections::Integer Value() const;
 
-  [[nodiscard]] Index ToU64() const { return Collections::ToU64(value); }
+  [[nodiscard]] bool IsSmall() const { return isSmall; }
+
+  /**
+   * @brief 内联存放的值，仅在 IsSmall() 时有效
+   */
+  [[nodiscard]] int64_t SmallValue() const { return small; }
+  [[nodiscard]] Index MemoryFootprint() const override {
+    return sizeof(PyInteger) + (isSmall ? 0 : big.HeapBytes());
+  }
+
+  [[nodiscard]] Index ToU64() const;
 
   [[nodiscard]] bool IsBigNumber() const {
-    return Collections::IsBigNumber(value);
+    return !isSmall && Collections::IsBigNumber(big);
   }
 
   [[nodiscard]] Collections::Integer::IntSign GetSign() const {
-    return value.GetSign();
+    if (isSmall) {
+      return small < 0 ? Collections::Integer::IntSign::Negative
+                       : Collections::Integer::IntSign::Positive;
+    }
+    return big.GetSign();
   }
 
-  [[nodiscard]] int64_t ToI64() const { return Collections::ToI64(value); }
+  [[nodiscard]] int64_t ToI64() const {
+    return isSmall ? small : Collections::ToI64(big);
+  }
 
   [[nodiscard]] bool LessThan(const PyObjPtr& other) const;
 
   [[nodiscard]] bool Equal(const PyObjPtr& other) const;
 };
 
+/**
+ * @brief 整数的加、减、乘
+ * @details 两个操作数都内联存放且结果没有溢出时直接得到新的内联整数，
+ * 否则转换成大整数计算。IntegerKlass 和解释器的整数特化指令共用
+ */
+PyObjPtr IntegerAdd(const PyInteger& lhs, const PyInteger& rhs);
+
+PyObjPtr IntegerSubtract(const PyInteger& lhs, const PyInteger& rhs);
+
+PyObjPtr IntegerMultiply(const PyInteger& lhs, const PyInteger& rhs);
+
+bool IntegerLessThan(const PyInteger& lhs, const PyInteger& rhs);
+
+bool IntegerEqual(const PyInteger& lhs, const PyInteger& rhs);
+
+/**
+ * @brief 小整数缓存的命中统计
+ * @details misses 统计的是缓存范围之外新分配的整数
+ */
+struct SmallIntegerCacheStats {
+  uint64_t hits;
+  uint64_t misses;
+};
+
+[[nodiscard]] SmallIntegerCacheStats GetSmallIntegerCacheStats();
+
 }  // namespace kaubo::Object
@@ -2,6 +2,7 @@
 
 #include <gsl/gsl>
 #include <memory>
+#include "Object/Core/Ref.h"
 
 namespace kaubo::Object {
 
@@ -9,16 +10,16 @@ class Klass;
 using KlassPtr = gsl::owner<Klass*>;
 
 class PyObject;
-using PyObjPtr = std::shared_ptr<PyObject>;
+using PyObjPtr = Ref<PyObject>;
 class PyString;
-using PyStrPtr = std::shared_ptr<PyString>;
+using PyStrPtr = Ref<PyString>;
 class PyList;
-using PyListPtr = std::shared_ptr<PyList>;
+using PyListPtr = Ref<PyList>;
 class PyDictionary;
-using PyDictPtr = std::shared_ptr<PyDictionary>;
+using PyDictPtr = Ref<PyDictionary>;
 class PyType;
-using PyTypePtr = std::shared_ptr<PyType>;
+using PyTypePtr = Ref<PyType>;
 class PyInteger;
-using PyIntPtr = std::shared_ptr<PyInteger>;
+using PyIntPtr = Ref<PyInteger>;
 
 }  // namespace kaubo::Object
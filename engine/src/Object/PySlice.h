@@ -29,6 +29,8 @@ class PySlice : public PyObject {
   PyObjPtr step;
 
  public:
+  using KlassType = SliceKlass;
+
   PySlice(PyObjPtr _start, PyObjPtr _stop, PyObjPtr _step)
     : PyObject(SliceKlass::Self()),
       start(std::move(_start)),
@@ -53,8 +55,8 @@ inline PyObjPtr CreatePySlice(
   const PyObjPtr& stop,
   const PyObjPtr& step
 ) {
-  return std::make_shared<PySlice>(start, stop, step);
+  return MakeRef<PySlice>(start, stop, step);
 }
-using PySlicePtr = std::shared_ptr<PySlice>;
+using PySlicePtr = Ref<PySlice>;
 
 }  // namespace kaubo::Object
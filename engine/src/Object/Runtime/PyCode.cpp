@@ -10,6 +10,10 @@
 #include "Object/String/PyString.h"
 #include "Tools/Terminal/VerboseTerminal.h"
 
+#include <algorithm>
+#include <cstdlib>
+#include <optional>
+
 namespace kaubo::Object {
 
 PyCode::PyCode(
@@ -19,6 +23,7 @@ PyCode::PyCode(
   PyListPtr varNames,
   PyStrPtr name,
   Index nLocals,
+  Index stackSize,
   bool isGenerator
 )
   : PyObject(CodeKlass::Self()),
@@ -29,18 +34,348 @@ PyCode::PyCode(
     varNames(std::move(varNames)),
     name(std::move(name)),
     nLocals(nLocals),
+    stackSize(stackSize),
     isGenerator(isGenerator) {}
 
 PyListPtr PyCode::Instructions() {
+  if (instructions == nullptr && (isDecoded || byteCode != nullptr)) {
+    const auto& stream = Insts();
+    auto list = PyList::Create(PyList::ExpandAndFill{stream.Size()});
+    for (Index i = 0; i < stream.Size(); i++) {
+      // 执行期的特化不属于 code 本身，还原成通用指令
+      list->SetItem(
+        i, UnpackInst(Inst{GenericOf(stream[i].code), stream[i].operand})
+      );
+    }
+    instructions = list;
+  }
   return instructions;
 }
 
-void PyCode::SetInstructions(PyListPtr&& insts) {
-  instructions = std::move(insts);
+void PyCode::SetInstructions(PyListPtr&& _insts) {
+  instructions = std::move(_insts);
+  isDecoded = false;
+  tablesReady = false;
+}
+
+const Collections::List<Inst>& PyCode::Insts() {
+  if (isDecoded) {
+    return insts;
+  }
+  if (instructions != nullptr) {
+    Collections::List<Inst> stream(instructions->Length());
+    for (Index i = 0; i < instructions->Length(); i++) {
+      stream.Push(PackInst(instructions->GetItem(i)->as<PyInst>()));
+    }
+    insts = std::move(stream);
+  } else if (byteCode != nullptr) {
+    DecodeByteCode();
+  }
+  isDecoded = true;
+  return insts;
+}
+
+Inst* PyCode::AdaptiveInsts() {
+  static_cast<void>(Insts());
+  return insts.Data();
+}
+
+uint8_t* PyCode::WarmupCounters() {
+  const Index count = Insts().Size();
+  if (warmupCounters.Size() != count) {
+    warmupCounters = Collections::List<uint8_t>(count, ADAPTIVE_WARMUP);
+  }
+  return warmupCounters.Data();
+}
+
+NameCache* PyCode::GlobalCaches() {
+  if (globalCaches.Size() != names->Length()) {
+    globalCaches = Collections::List<NameCache>(names->Length(), NameCache{});
+  }
+  return globalCaches.Data();
+}
+
+NameCache* PyCode::NameCaches() {
+  if (nameCaches.Size() != names->Length()) {
+    nameCaches = Collections::List<NameCache>(names->Length(), NameCache{});
+  }
+  return nameCaches.Data();
+}
+
+AttrCache* PyCode::AttrCaches() {
+  const auto& stream = Insts();
+  const Index count = stream.Size();
+  if (attrCacheSlots.Size() != count) {
+    attrCacheSlots = Collections::List<Index>(count, Index{0});
+    Index sites = 0;
+    for (Index pc = 0; pc < count; pc++) {
+      const auto code = GenericOf(stream[pc].code);
+      if (code == Object::ByteCode::LOAD_ATTR ||
+          code == Object::ByteCode::STORE_ATTR ||
+          code == Object::ByteCode::LOAD_METHOD) {
+        attrCacheSlots[pc] = sites++;
+      }
+    }
+    if (sites > 0) {
+      attrCaches = Collections::List<AttrCache>(sites, AttrCache{});
+    }
+  }
+  return attrCaches.Data();
+}
+
+const Index* PyCode::AttrCacheSlots() {
+  static_cast<void>(AttrCaches());
+  return attrCacheSlots.Data();
+}
+
+void PyCode::PrepareTables() {
+  tables.instructions = AdaptiveInsts();
+  tables.counters = WarmupCounters();
+  tables.globalCaches = GlobalCaches();
+  tables.nameCaches = NameCaches();
+  tables.attrCaches = AttrCaches();
+  tables.attrCacheSlots = AttrCacheSlots();
+  tables.consts = ConstTable();
+  tables.names = NameTable();
+  tables.instCount = Insts().Size();
+  tablesReady = true;
+}
+
+void PyCode::ComputeStackSize() {
+  const auto& stream = Insts();
+  const Index count = stream.Size();
+  // depth[pc] 记录进入该指令时的栈深度，-1 表示尚未到达
+  Collections::List<int64_t> depth(count, -1);
+  Collections::List<Index> pending;
+  // 生成器首次启动时 Send 会先压入一个值
+  int64_t maxDepth = isGenerator ? 1 : 0;
+  auto reach = [&depth, &pending, count](Index target, int64_t value) {
+    if (target < count && depth[target] < 0) {
+      depth[target] = value;
+      pending.Push(target);
+    }
+  };
+  reach(0, maxDepth);
+  while (!pending.Empty()) {
+    Index pc = pending.Pop();
+    int64_t current = depth[pc];
+    while (pc < count) {
+      const auto& inst = stream[pc];
+      int64_t next = current + StackEffect(inst);
+      maxDepth = std::max({maxDepth, current, next});
+      switch (inst.code) {
+        case Object::ByteCode::RETURN_VALUE:
+          next = -1;
+          break;
+        case Object::ByteCode::JUMP_ABSOLUTE:
+          reach(inst.operand, next);
+          next = -1;
+          break;
+        case Object::ByteCode::JUMP_FORWARD:
+          reach(pc + inst.operand, next);
+          next = -1;
+          break;
+        case Object::ByteCode::FOR_ITER:
+          reach(pc + inst.operand, current + StackEffect(inst, true));
+          break;
+        case Object::ByteCode::POP_JUMP_IF_FALSE:
+        case Object::ByteCode::POP_JUMP_IF_TRUE:
+          reach(
+            static_cast<Index>(
+              static_cast<int64_t>(pc) + static_cast<int32_t>(inst.operand)
+            ),
+            next
+          );
+          break;
+        case Object::ByteCode::COMPARE_AND_BRANCH:
+          reach(
+            static_cast<Index>(
+              static_cast<int64_t>(pc) + BranchOffsetOf(inst.operand)
+            ),
+            next
+          );
+          break;
+        default:
+          break;
+      }
+      if (next < 0 || ++pc >= count || depth[pc] >= 0) {
+        break;
+      }
+      depth[pc] = next;
+      current = next;
+    }
+  }
+  stackSize = static_cast<Index>(maxDepth);
+}
+
+namespace {
+
+/**
+ * @brief 跳转指令的目标下标，非跳转指令返回 std::nullopt
+ */
+std::optional<Index> JumpTargetOf(const Inst& inst, Index pc) {
+  switch (inst.code) {
+    case Object::ByteCode::JUMP_ABSOLUTE:
+      return Index{inst.operand};
+    case Object::ByteCode::JUMP_FORWARD:
+    case Object::ByteCode::FOR_ITER:
+      return pc + inst.operand;
+    case Object::ByteCode::POP_JUMP_IF_FALSE:
+    case Object::ByteCode::POP_JUMP_IF_TRUE:
+      return static_cast<Index>(
+        static_cast<int64_t>(pc) + static_cast<int32_t>(inst.operand)
+      );
+    case Object::ByteCode::COMPARE_AND_BRANCH:
+      return static_cast<Index>(
+        static_cast<int64_t>(pc) + BranchOffsetOf(inst.operand)
+      );
+    default:
+      return std::nullopt;
+  }
+}
+
+}  // namespace
+
+void PyCode::FuseSuperInstructions() {
+  const auto& stream = Insts();
+  const Index count = stream.Size();
+  // 被跳转指向的指令是基本块的入口，不能被并入前一条指令
+  Collections::List<bool> isTarget(count + 1, false);
+  for (Index pc = 0; pc < count; pc++) {
+    if (auto target = JumpTargetOf(stream[pc], pc)) {
+      isTarget[std::min(*target, count)] = true;
+    }
+  }
+  auto fusible = [&stream, &isTarget, count](Index pc, Index length) {
+    if (pc + length > count) {
+      return false;
+    }
+    for (Index i = pc + 1; i < pc + length; i++) {
+      if (isTarget[i]) {
+        return false;
+      }
+    }
+    return true;
+  };
+  auto codeAt = [&stream](Index pc) { return stream[pc].code; };
+
+  Collections::List<Inst> fused(count);
+  // newIndex: 合并前每条指令在合并后指令流中的位置
+  // origin: 合并后每条指令对应的最后一条原指令，重定位时取它的跳转目标
+  Collections::List<Index> newIndex(count + 1, Index{0});
+  Collections::List<Index> origin(count);
+  Index pc = 0;
+  while (pc < count) {
+    const auto& inst = stream[pc];
+    Inst result = inst;
+    Index length = 1;
+    if (inst.code == Object::ByteCode::LOAD_FAST && fusible(pc, 4) &&
+        codeAt(pc + 1) == Object::ByteCode::LOAD_CONST &&
+        codeAt(pc + 2) == Object::ByteCode::BINARY_ADD &&
+        codeAt(pc + 3) == Object::ByteCode::STORE_FAST &&
+        stream[pc + 3].operand == inst.operand &&
+        inst.operand < SUPER_INDEX_LIMIT &&
+        stream[pc + 1].operand < SUPER_INDEX_LIMIT) {
+      result = Inst{
+        Object::ByteCode::INCREMENT_FAST_CONST,
+        PackIndexPair(inst.operand, stream[pc + 1].operand)
+      };
+      length = 4;
+    } else if (inst.code == Object::ByteCode::LOAD_FAST && fusible(pc, 2) &&
+               codeAt(pc + 1) == Object::ByteCode::LOAD_FAST &&
+               inst.operand < SUPER_INDEX_LIMIT &&
+               stream[pc + 1].operand < SUPER_INDEX_LIMIT) {
+      result = Inst{
+        Object::ByteCode::LOAD_FAST_LOAD_FAST,
+        PackIndexPair(inst.operand, stream[pc + 1].operand)
+      };
+      length = 2;
+    } else if (inst.code == Object::ByteCode::COMPARE_OP && fusible(pc, 2) &&
+               codeAt(pc + 1) == Object::ByteCode::POP_JUMP_IF_FALSE &&
+               std::abs(int64_t{static_cast<int32_t>(stream[pc + 1].operand)}) <
+                 SUPER_OFFSET_LIMIT) {
+      // 跳转偏移在重定位阶段再填入，这里先保留比较运算符
+      result = Inst{Object::ByteCode::COMPARE_AND_BRANCH, inst.operand};
+      length = 2;
+    }
+    for (Index i = pc; i < pc + length; i++) {
+      newIndex[i] = fused.Size();
+    }
+    origin.Push(pc + length - 1);
+    fused.Push(result);
+    pc += length;
+  }
+  newIndex[count] = fused.Size();
+  if (fused.Size() == count) {
+    return;
+  }
+
+  // 重定位：跳转目标换算成合并后的位置，COMPARE_AND_BRANCH
+  // 取其末尾 POP_JUMP_IF_FALSE 的目标
+  for (Index i = 0; i < fused.Size(); i++) {
+    auto& inst = fused[i];
+    auto target = JumpTargetOf(stream[origin[i]], origin[i]);
+    if (!target) {
+      continue;
+    }
+    const auto to = static_cast<int64_t>(newIndex[std::min(*target, count)]);
+    const auto offset = to - static_cast<int64_t>(i);
+    switch (inst.code) {
+      case Object::ByteCode::JUMP_ABSOLUTE:
+        inst.operand = static_cast<uint32_t>(to);
+        break;
+      case Object::ByteCode::COMPARE_AND_BRANCH:
+        // 合并只会缩短跳转距离，匹配时检查过的范围依然成立
+        inst.operand = PackCompareBranch(CompareOpOf(inst.operand), offset);
+        break;
+      default:
+        inst.operand = static_cast<uint32_t>(static_cast<int32_t>(offset));
+        break;
+    }
+  }
+  insts = std::move(fused);
+  isDecoded = true;
+  tablesReady = false;
+  // PyInst 列表按需从新的指令流还原
+  instructions = nullptr;
+}
+
+void PyCode::DecodeByteCode() {
+  auto bytes = byteCode->Value().CopyCodeUnits();
+  Index iter = 0;
+  if (static_cast<Literal>(bytes[iter]) != Literal::LIST) {
+    throw std::runtime_error("Invalid insts");
+  }
+  iter++;
+  Index size = Collections::DeserializeU64(bytes, iter);
+  Collections::List<Inst> stream(size);
+  for (Index pcCounter = 0; pcCounter < size; pcCounter++) {
+    auto op = static_cast<Object::ByteCode>(bytes[iter++]);
+    uint32_t operand = 0;
+    switch (OperandTypeOf(op)) {
+      case OperandType::NONE:
+        break;
+      case OperandType::INDEX:
+        operand =
+          static_cast<uint32_t>(Collections::DeserializeU64(bytes, iter));
+        break;
+      case OperandType::COMPARE:
+        operand = bytes[iter++];
+        break;
+      case OperandType::OFFSET:
+        operand = static_cast<uint32_t>(
+          static_cast<int32_t>(Collections::DeserializeI64(bytes, iter))
+        );
+        break;
+    }
+    stream.Push(Inst{op, operand});
+  }
+  insts = std::move(stream);
 }
 
 void PyCode::SetByteCode(const PyBytesPtr& byteCodes) {
   byteCode = byteCodes;
+  tablesReady = false;
 }
 
 void PyCode::SetNLocals(Index _nLocals) {
@@ -100,6 +435,9 @@ PyObjPtr CodeKlass::eq(const PyObjPtr& lhs, const PyObjPtr& rhs) {
   if (lhsc->NLocals() != rhsc->NLocals()) {
     return PyBoolean::Create(false);
   }
+  if (lhsc->StackSize() != rhsc->StackSize()) {
+    return PyBoolean::Create(false);
+  }
   if (!IsTrue(lhsc->Instructions()->eq(rhsc->Instructions()))) {
     return PyBoolean::Create(false);
   }
@@ -110,8 +448,7 @@ PyObjPtr CodeKlass::repr(const PyObjPtr& self) {
   return StringConcat(
     PyList::Create<Object::PyObjPtr>(
       {PyString::Create("<code object at ")->as<PyString>(),
-       Function::Identity(PyList::Create<Object::PyObjPtr>({self}))
-         ->as<PyString>(),
+       Function::Identity(nullptr, &self, 1)->as<PyString>(),
        PyString::Create(">")->as<PyString>()}
     )
   );
@@ -128,6 +465,7 @@ PyObjPtr CodeKlass::_serialize_(const PyObjPtr& self) {
   result.Append(code->VarNames()->_serialize_()->as<PyBytes>()->Value());
   result.Append(code->Name()->_serialize_()->as<PyBytes>()->Value());
   result.Append(Collections::Serialize(code->NLocals()));
+  result.Append(Collections::Serialize(code->StackSize()));
   result.Append(
     Collections::Serialize(
       code->IsGenerator() ? Literal::TRUE_LITERAL : Literal::FALSE_LITERAL
@@ -150,6 +488,7 @@ Index PyCode::IndexOfConst(const PyObjPtr& obj) {
 void PyCode::RegisterConst(const PyObjPtr& obj) {
   if (!consts->Contains(obj)) {
     consts->Append(obj);
+    tablesReady = false;
   }
 }
 
@@ -164,6 +503,7 @@ Index PyCode::IndexOfName(const PyObjPtr& _name) {
 void PyCode::RegisterName(const PyObjPtr& _name) {
   if (!names->Contains(_name)) {
     names->Append(_name);
+    tablesReady = false;
   }
 }
 
@@ -185,8 +525,8 @@ PyCodePtr CreatePyCode(const PyStrPtr& name) {
   auto consts = PyList::Create();
   auto names = PyList::Create();
   auto varNames = PyList::Create();
-  return std::make_shared<PyCode>(
-    byteCode, consts, names, varNames, name, 0, false
+  return MakeRef<PyCode>(
+    byteCode, consts, names, varNames, name, Index{0}, Index{0}, false
   );
 }
 
@@ -230,6 +570,10 @@ void PrintCode(const PyCodePtr& code) {
   VerboseTerminal::DecreaseIndent();
   VerboseTerminal::get_instance().info("nLocals: ");
   VerboseTerminal::get_instance().info(std::to_string(codeObj->NLocals()) + "");
+  VerboseTerminal::get_instance().info("stackSize: ");
+  VerboseTerminal::get_instance().info(
+    std::to_string(codeObj->StackSize()) + ""
+  );
 
   VerboseTerminal::DecreaseIndent();
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <cstdint>
 #include "Object/Container/PyList.h"
 #include "Object/Core/CoreHelper.h"
@@ -14,13 +15,78 @@ namespace kaubo::Object {
 
 class PyCode;
 
-using PyCodePtr = std::shared_ptr<PyCode>;
+using PyCodePtr = Ref<PyCode>;
 enum class Scope : uint8_t { ERR = 0, LOCAL, GLOBAL, Closure };
 
+/**
+ * @brief LOAD_GLOBAL / LOAD_NAME 的查找缓存
+ * @details 记录上次查找时各个字典的键集合版本和找到的值所在的槽位，
+ * 版本全部一致时直接读槽位，赋值给已有的名字不会使缓存失效。
+ * 字典版本号从不为 0，所以空缓存不会命中
+ */
+struct NameCache {
+  Index localsVersion = 0;
+  Index globalsVersion = 0;
+  Index builtinsVersion = 0;
+  PyObjPtr* slot = nullptr;
+};
+
+/**
+ * @brief LOAD_ATTR / STORE_ATTR / LOAD_METHOD 内联缓存中的一项
+ * @details 以对象的 Klass 和 Klass 的版本为键，记录上次查找的结论：
+ * 值在实例自身的属性里、是类上的普通属性，还是需要绑定 self 的方法。
+ * 同时记下当时实例的形状：形状相同的实例属性布局也相同，
+ * 可以直接按 slot 读写，或确定实例没有遮蔽类上的同名属性。
+ * STORE_ATTR 用 klass 和 version 表示该类可以直接写实例属性，
+ * 用 shape、nextShape 和 slot 记录写入前后的形状和写入的槽位
+ */
+struct AttrCacheEntry {
+  enum class Kind : uint8_t { INSTANCE, CLASS_ATTR, METHOD };
+  KlassPtr klass = nullptr;
+  Index version = 0;
+  Kind kind = Kind::INSTANCE;
+  PyObjPtr value;  // CLASS_ATTR 与 METHOD 在类上找到的值
+  Shape* shape = nullptr;      // 为 nullptr 时不按形状走快速路径
+  Shape* nextShape = nullptr;  // STORE_ATTR 写入后的形状
+  Index slot = 0;
+};
+
+/**
+ * @brief 一条 LOAD_ATTR / STORE_ATTR / LOAD_METHOD 指令的内联缓存
+ * @details 同一条指令见过的 Klass 不超过 WAYS 个时都能命中，
+ * 更多时按轮转顺序替换旧项
+ */
+struct AttrCache {
+  static constexpr Index WAYS = 4;
+  std::array<AttrCacheEntry, WAYS> entries;
+  Index next = 0;
+};
+
+/**
+ * @brief 解释循环进入一个 code 时要用到的各张表
+ * @details 由 PyCode::Tables() 一次备好，帧切换时整组取出，
+ * 不必在每次调用和返回时逐个经过带检查的访问函数
+ */
+struct EvalTables {
+  Inst* instructions = nullptr;
+  uint8_t* counters = nullptr;
+  NameCache* globalCaches = nullptr;
+  NameCache* nameCaches = nullptr;
+  AttrCache* attrCaches = nullptr;
+  const Index* attrCacheSlots = nullptr;
+  const PyObjPtr* consts = nullptr;
+  const PyObjPtr* names = nullptr;
+  Index instCount = 0;
+};
+
+class CodeKlass;
+
 class PyCode : public PyObject {
   friend class CodeKlass;
 
  public:
+  using KlassType = CodeKlass;
+
   explicit PyCode(
     PyBytesPtr byteCodes,
     PyListPtr consts,
@@ -28,13 +94,64 @@ class PyCode : public PyObject {
     PyListPtr varNames,
     PyStrPtr name,
     Index nLocals,
+    Index stackSize,
     bool isGenerator
   );
 
+  /**
+   * @brief 以 PyInst 列表形式访问指令
+   * @details 编译期用于追加和回填指令；从字节码加载的 code
+   * 只有在调试输出或序列化时才会由紧凑指令流还原出这个列表
+   */
   [[nodiscard]] PyListPtr Instructions();
 
   void SetInstructions(PyListPtr&& insts);
 
+  /**
+   * @brief 解码后的紧凑指令流，首次访问时解码一次，供 PyFrame::Eval 使用
+   */
+  [[nodiscard]] const Collections::List<Inst>& Insts();
+
+  /**
+   * @brief 自适应解释使用的可写指令流
+   * @details 与 Insts() 是同一份指令，PyFrame::Eval 在执行中把通用指令
+   * 原地改写为类型特化的指令
+   */
+  [[nodiscard]] Inst* AdaptiveInsts();
+
+  /**
+   * @brief 每条指令的预热计数，与指令流等长
+   */
+  [[nodiscard]] uint8_t* WarmupCounters();
+
+  /**
+   * @brief 按名字下标存放的查找缓存，LOAD_GLOBAL 与 LOAD_NAME 各用一份
+   * @details 查找结果只取决于名字和所查的字典，同一 code 中引用同一个名字的
+   * 指令共用一个缓存项
+   */
+  [[nodiscard]] NameCache* GlobalCaches();
+
+  [[nodiscard]] NameCache* NameCaches();
+
+  /**
+   * @brief 每条 LOAD_ATTR / STORE_ATTR / LOAD_METHOD 指令一份的内联缓存
+   * @details 用 AttrCacheSlots()[pc] 得到指令 pc 的缓存下标
+   */
+  [[nodiscard]] AttrCache* AttrCaches();
+
+  [[nodiscard]] const Index* AttrCacheSlots();
+
+  /**
+   * @brief 解释循环使用的全部表，首次访问时备好，之后直接返回
+   * @details 指令流、常量表或名字表被改动后重新准备
+   */
+  [[nodiscard]] const EvalTables& Tables() {
+    if (!tablesReady) {
+      PrepareTables();
+    }
+    return tables;
+  }
+
   void SetByteCode(const PyBytesPtr& byteCodes);
 
   void SetNLocals(Index nLocals);
@@ -47,12 +164,45 @@ class PyCode : public PyObject {
 
   [[nodiscard]] PyListPtr Names() const;
 
+  /**
+   * @brief 常量表与名字表的连续存储，供 PyFrame::Eval 按操作数直接下标访问
+   * @details 两张表只在编译期追加，解释循环在入口处各取一次指针
+   */
+  [[nodiscard]] const PyObjPtr* ConstTable() const { return consts->Data(); }
+
+  [[nodiscard]] const PyObjPtr* NameTable() const { return names->Data(); }
+
   [[nodiscard]] PyStrPtr Name() const;
 
+  /**
+   * @details 只计对象本身，指令流和各类缓存表不计入
+   */
+  [[nodiscard]] Index MemoryFootprint() const override {
+    return sizeof(PyCode);
+  }
+
   [[nodiscard]] PyListPtr VarNames() const;
 
   [[nodiscard]] Index NLocals() const;
 
+  /**
+   * @brief 操作数栈的最大深度，PyFrame 按此大小一次性分配栈空间
+   */
+  [[nodiscard]] Index StackSize() const { return stackSize; }
+
+  /**
+   * @brief 对指令流做一次栈深度分析，记录最大栈深度
+   * @details 由代码生成在一个 code 的指令全部生成后调用
+   */
+  void ComputeStackSize();
+
+  /**
+   * @brief 窥孔优化：把常见的指令序列合并成超级指令
+   * @details 由代码生成在一个 code 的指令全部生成后、栈深度分析之前调用。
+   * 被跳转指向的指令不会被并入前面的序列，合并后重新计算所有跳转目标
+   */
+  void FuseSuperInstructions();
+
   [[nodiscard]] Scope GetScope() const;
 
   void EnableGenerator() { isGenerator = true; }
@@ -94,6 +244,11 @@ class PyCode : public PyObject {
     instructions->Append(MakeInst<ByteCode::LOAD_ATTR>(index));
   }
 
+  void LoadMethod(const PyObjPtr& obj) {
+    auto index = IndexOfName(obj);
+    instructions->Append(MakeInst<ByteCode::LOAD_METHOD>(index));
+  }
+
   void LoadGlobal(const PyObjPtr& obj) {
     auto index = IndexOfName(obj);
     instructions->Append(MakeInst<ByteCode::LOAD_GLOBAL>(index));
@@ -123,6 +278,10 @@ class PyCode : public PyObject {
     instructions->Append(MakeInst<ByteCode::CALL_FUNCTION>(nArgs));
   }
 
+  void CallMethod(Index nArgs) {
+    instructions->Append(MakeInst<ByteCode::CALL_METHOD>(nArgs));
+  }
+
   void MakeFunction() {
     instructions->Append(MakeInst<ByteCode::MAKE_FUNCTION>());
   }
@@ -216,19 +375,33 @@ class PyCode : public PyObject {
   void YieldValue() { instructions->Append(MakeInst<ByteCode::YIELD_VALUE>()); }
 
  private:
+  void DecodeByteCode();
+
+  void PrepareTables();
+
   PyBytesPtr byteCode;
 
   PyListPtr instructions;
+  Collections::List<Inst> insts;
+  Collections::List<uint8_t> warmupCounters;
+  Collections::List<NameCache> globalCaches;
+  Collections::List<NameCache> nameCaches;
+  Collections::List<Index> attrCacheSlots;
+  Collections::List<AttrCache> attrCaches;
+  bool isDecoded = false;
+  EvalTables tables;
+  bool tablesReady = false;
   PyListPtr consts;
   PyListPtr names;
   PyListPtr varNames;
   PyStrPtr name;
   Index nLocals;
+  Index stackSize = 0;
   bool isGenerator = false;
   enum Scope scope = Scope::ERR;
 };
 
-using PyCodePtr = std::shared_ptr<PyCode>;
+using PyCodePtr = Ref<PyCode>;
 
 class CodeKlass : public KlassBase<CodeKlass> {
  public:
@@ -260,10 +433,11 @@ inline PyObjPtr CreatePyCode(
   const PyListPtr& varNames,
   const PyStrPtr& name,
   Index nLocals,
+  Index stackSize,
   bool isGenerator
 ) {
-  return std::make_shared<PyCode>(
-    byteCode, consts, names, varNames, name, nLocals, isGenerator
+  return MakeRef<PyCode>(
+    byteCode, consts, names, varNames, name, nLocals, stackSize, isGenerator
   );
 }
 
@@ -1,6 +1,6 @@
 #include "Object/Runtime/PyFrame.h"
 #include "ByteCode/ByteCode.h"
-#include "Collections/Stack.h"
+#include "Collections/FixedStack.h"
 #include "Collections/String/BytesHelper.h"
 #include "Function/BuiltinFunction.h"
 #include "Object/Container/PyDictionary.h"
@@ -10,44 +10,119 @@
 #include "Object/Core/PyObject.h"
 #include "Object/Core/PyType.h"
 #include "Object/Function/PyFunction.h"
+#include "Object/Function/PyIife.h"
+#include "Object/Function/PyMethod.h"
+#include "Object/Function/PyNativeFunction.h"
 #include "Object/Iterator/Iterator.h"
 #include "Object/Iterator/PyGenerator.h"
+#include "Object/Number/PyFloat.h"
 #include "Object/Number/PyInteger.h"
 #include "Object/PySlice.h"
 #include "Object/Runtime/PyCode.h"
 #include "Object/Runtime/PyInst.h"
 #include "Object/String/PyString.h"
+#include "Runtime/FrameArena.h"
+#include "Runtime/GarbageCollector.h"
 #include "Runtime/VirtualMachine.h"
 #include "Tools/Config/Config.h"
 #include "Tools/Terminal/Terminal.h"
 #include "Tools/Terminal/VerboseTerminal.h"
 
+#include <algorithm>
+#include <memory>
+#include <new>
+
 namespace kaubo::Object {
 
+namespace {
+
+PyObjPtr* AllocateSlots(Runtime::FrameArena* arena, Index count) {
+  const Index bytes = count * sizeof(PyObjPtr);
+  void* memory =
+    arena != nullptr ? arena->Allocate(bytes) : ::operator new(bytes);
+  auto* slots = static_cast<PyObjPtr*>(memory);
+  std::uninitialized_value_construct_n(slots, count);
+  return slots;
+}
+
+}  // namespace
+
 PyFrame::PyFrame(
   PyCodePtr code,
   PyDictPtr locals,
   PyDictPtr globals,
-  PyListPtr fastLocals,
-  PyFramePtr caller
+  PyObjPtr* arguments,
+  Index nArguments,
+  PyFramePtr caller,
+  Runtime::FrameArena* arena
 )
-  : PyObject(FrameKlass::Self()),
-    stack(),
+  : PyContainer(FrameKlass::Self()),
+    arena(arena),
+    nFastLocals(std::max(code->NLocals(), nArguments)),
+    nSlots(nFastLocals + code->StackSize()),
+    fastLocals(AllocateSlots(arena, nSlots)),
+    stack(fastLocals + nFastLocals, code->StackSize()),
     programCounter(0),
     code(std::move(code)),
     locals(std::move(locals)),
     globals(std::move(globals)),
-    fastLocals(std::move(fastLocals)),
-    caller(std::move(caller)) {}
+    caller(std::move(caller)) {
+  // 参数依次放入前几个槽位，其余槽位初始化为 None
+  for (Index i = 0; i < nArguments; i++) {
+    fastLocals[i] = std::move(arguments[i]);
+  }
+  for (Index i = nArguments; i < nFastLocals; i++) {
+    fastLocals[i] = PyNone::Instance();
+  }
+}
+
+PyFrame::~PyFrame() {
+  std::destroy_n(fastLocals, nSlots);
+  if (arena != nullptr) {
+    arena->Deallocate(fastLocals);
+  } else {
+    ::operator delete(fastLocals);
+  }
+}
+
+void PyFrame::Traverse(GcVisitor& visitor) {
+  // 操作数栈弹出的槽位已被移空，所有槽位一起遍历即可
+  for (Index i = 0; i < nSlots; i++) {
+    visitor.Visit(fastLocals[i]);
+  }
+  visitor.Visit(code);
+  visitor.Visit(locals);
+  visitor.Visit(globals);
+  visitor.Visit(caller);
+}
+
+void PyFrame::ClearReferences() {
+  for (Index i = 0; i < nSlots; i++) {
+    fastLocals[i] = nullptr;
+  }
+  code = nullptr;
+  locals = nullptr;
+  globals = nullptr;
+  caller = nullptr;
+}
+
+void PyFrame::Dispose() noexcept {
+  if (arena == nullptr) {
+    delete this;
+    return;
+  }
+  auto* owner = arena;
+  this->~PyFrame();
+  owner->Deallocate(this);
+}
 
 PyFramePtr CreateModuleEntryFrame(const PyCodePtr& code) {
   auto locals = PyDictionary::Create();
   auto globals = locals;
   locals->Put(PyString::Create("__name__"), PyString::Create("__main__"));
-  auto fastLocals = PyList::Create(Object::PyList::ExpandOnly{code->NLocals()});
   auto caller = nullptr;
   auto frame =
-    std::make_shared<PyFrame>(code, locals, globals, fastLocals, caller);
+    MakeRef<PyFrame>(code, locals, globals, nullptr, Index{0}, caller);
   Runtime::VirtualMachine::Instance().SetFrame(frame);
   return frame;
 }
@@ -55,18 +130,39 @@ PyFramePtr CreateModuleEntryFrame(const PyCodePtr& code) {
 PyFramePtr CreateFrameWithPyFunction(
   const PyFunctionPtr& function,
   const PyListPtr& arguments
+) {
+  // 参数列表可能还被别处引用，复制一份再移入新帧
+  PyListElements copied(arguments->Length());
+  for (Index i = 0; i < arguments->Length(); i++) {
+    copied.Push(arguments->GetItem(i));
+  }
+  return CreateFrameWithPyFunction(function, copied.Data(), copied.Size());
+}
+
+PyFramePtr CreateFrameWithPyFunction(
+  const PyFunctionPtr& function,
+  PyObjPtr* arguments,
+  Index nArguments
 ) {
   auto code = function->Code();
   auto globals = function->Globals();
-  auto locals = PyDictionary::Create();
-  Index nLocals = code->NLocals();
-  for (Index i = arguments->Length(); i < nLocals; i++) {
-    arguments->Append(PyNone::Instance());
+  auto& vm = Runtime::VirtualMachine::Instance();
+  auto caller = vm.CurrentFrame();
+  PyFramePtr frame;
+  if (code->IsGenerator()) {
+    // 生成器帧在调用返回后还要继续存活，不能放进按后进先出回收的分配区
+    frame = MakeRef<PyFrame>(
+      code, nullptr, globals, arguments, nArguments, caller
+    );
+  } else {
+    auto* arena = &vm.Frames();
+    void* memory = arena->Allocate(sizeof(PyFrame));
+    frame = PyFramePtr(
+      new (memory)
+        PyFrame(code, nullptr, globals, arguments, nArguments, caller, arena)
+    );
   }
-  auto caller = Runtime::VirtualMachine::Instance().CurrentFrame();
-  auto frame =
-    std::make_shared<PyFrame>(code, locals, globals, arguments, caller);
-  Runtime::VirtualMachine::Instance().SetFrame(frame);
+  vm.SetFrame(frame);
   return frame;
 }
 
@@ -82,16 +178,14 @@ Index PyFrame::ProgramCounter() const {
   return programCounter;
 }
 
-PyDictPtr PyFrame::CurrentLocals() const {
-  return locals;
-}
-
 PyDictPtr PyFrame::CurrentGlobals() const {
   return globals;
 }
 
 PyListPtr PyFrame::CurrentFastLocals() const {
-  return fastLocals;
+  return PyList::Create(
+    Collections::List<PyObjPtr>(nFastLocals, fastLocals)
+  );
 }
 
 PyListPtr PyFrame::DumpStack() const {
@@ -99,222 +193,17 @@ PyListPtr PyFrame::DumpStack() const {
 }
 
 PyInstPtr PyFrame::Instruction() const {
-  if (!isParsed) {
-    ParseByteCode(code);
-  }
-
-  return code->Instructions()->GetItem(programCounter)->as<PyInst>();
+  return UnpackInst(code->Insts()[programCounter]);
 }
 
 bool PyFrame::Finished() {
-  if (!isParsed) {
-    ParseByteCode(code);
-  }
-  this->isParsed = true;
-  auto size = code->Instructions()->Length();
-  return programCounter >= size;
+  return programCounter >= code->Insts().Size();
 }
 
 void PyFrame::NextProgramCounter() {
   programCounter++;
 }
 
-void ParseByteCode(const PyCodePtr& code) {
-  if (code->ByteCode() == nullptr) {
-    //    ConsoleTerminal::get_instance().log(
-    //      "bytecode passing in memory or something wrong"
-    //    );
-    return;
-  }
-  auto bytes = code->ByteCode()->Value().CopyCodeUnits();
-  Index iter = 0;
-  if (static_cast<Literal>(bytes[iter]) != Literal::LIST) {
-    throw std::runtime_error("Invalid insts");
-  }
-  iter++;
-  Index size = Collections::DeserializeU64(bytes, iter);
-  auto insts = PyList::Create(PyList::ExpandAndFill{size});
-  for (Index pcCounter = 0; pcCounter < size; pcCounter++) {
-    auto byte = bytes[iter++];
-    insts->SetItem(pcCounter, [byte, &iter, &bytes]() {
-      switch (static_cast<ByteCode>(byte)) {
-        case ByteCode::LOAD_CONST: {
-          return MakeInst<ByteCode::LOAD_CONST>(
-            Collections::DeserializeU64(bytes, iter)
-          );
-        }
-        case ByteCode::BINARY_ADD: {
-          return MakeInst<ByteCode::BINARY_ADD>();
-        }
-        case ByteCode::BINARY_MULTIPLY: {
-          return MakeInst<ByteCode::BINARY_MULTIPLY>();
-        }
-        case ByteCode::BINARY_SUBTRACT: {
-          return MakeInst<ByteCode::BINARY_SUBTRACT>();
-        }
-        case ByteCode::STORE_FAST: {
-          return MakeInst<ByteCode::STORE_FAST>(
-            Collections::DeserializeU64(bytes, iter)
-          );
-        }
-        case ByteCode::LOAD_FAST: {
-          return MakeInst<ByteCode::LOAD_FAST>(
-            Collections::DeserializeU64(bytes, iter)
-          );
-        }
-        case ByteCode::COMPARE_OP: {
-          auto compareOp = bytes[iter++];
-          return MakeInst<ByteCode::COMPARE_OP>(static_cast<CompareOp>(compareOp
-          ));
-        }
-        case ByteCode::POP_JUMP_IF_FALSE: {
-          return MakeInst<ByteCode::POP_JUMP_IF_FALSE>(
-            Collections::DeserializeI64(bytes, iter)
-          );
-        }
-        case ByteCode::POP_JUMP_IF_TRUE: {
-          return MakeInst<ByteCode::POP_JUMP_IF_TRUE>(
-            Collections::DeserializeI64(bytes, iter)
-          );
-        }
-        case ByteCode::MAKE_FUNCTION: {
-          return MakeInst<ByteCode::MAKE_FUNCTION>();
-        }
-        case ByteCode::CALL_FUNCTION: {
-          return MakeInst<ByteCode::CALL_FUNCTION>(
-            Collections::DeserializeU64(bytes, iter)
-          );
-        }
-        case ByteCode::RETURN_VALUE: {
-          return MakeInst<ByteCode::RETURN_VALUE>();
-        }
-        case ByteCode::LOAD_NAME: {
-          return MakeInst<ByteCode::LOAD_NAME>(
-            Collections::DeserializeU64(bytes, iter)
-          );
-        }
-        case ByteCode::STORE_NAME: {
-          return MakeInst<ByteCode::STORE_NAME>(
-            Collections::DeserializeU64(bytes, iter)
-          );
-        }
-        case ByteCode::LOAD_GLOBAL: {
-          return MakeInst<ByteCode::LOAD_GLOBAL>(
-            Collections::DeserializeU64(bytes, iter)
-          );
-        }
-        case ByteCode::POP_TOP: {
-          return MakeInst<ByteCode::POP_TOP>();
-        }
-        case ByteCode::LOAD_ATTR: {
-          return MakeInst<ByteCode::LOAD_ATTR>(
-            Collections::DeserializeU64(bytes, iter)
-          );
-        }
-        case ByteCode::BUILD_LIST: {
-          return MakeInst<ByteCode::BUILD_LIST>(
-            Collections::DeserializeU64(bytes, iter)
-          );
-        }
-        case ByteCode::BUILD_SLICE: {
-          return MakeInst<ByteCode::BUILD_SLICE>();
-        }
-        case ByteCode::BUILD_MAP: {
-          return MakeInst<ByteCode::BUILD_MAP>(
-            Collections::DeserializeU64(bytes, iter)
-          );
-        }
-        case ByteCode::BINARY_MATRIX_MULTIPLY: {
-          return MakeInst<ByteCode::BINARY_MATRIX_MULTIPLY>();
-        }
-        case ByteCode::JUMP_ABSOLUTE: {
-          return MakeInst<ByteCode::JUMP_ABSOLUTE>(
-            Collections::DeserializeU64(bytes, iter)
-          );
-        }
-        case ByteCode::BINARY_SUBSCR: {
-          return MakeInst<ByteCode::BINARY_SUBSCR>();
-        }
-        case ByteCode::STORE_SUBSCR: {
-          return MakeInst<ByteCode::STORE_SUBSCR>();
-        }
-        case ByteCode::GET_ITER: {
-          return MakeInst<ByteCode::GET_ITER>();
-        }
-        case ByteCode::FOR_ITER: {
-          return MakeInst<ByteCode::FOR_ITER>(
-            Collections::DeserializeU64(bytes, iter)
-          );
-        }
-        case ByteCode::LOAD_BUILD_CLASS: {
-          return MakeInst<ByteCode::LOAD_BUILD_CLASS>();
-        }
-        case ByteCode::STORE_ATTR: {
-          return MakeInst<ByteCode::STORE_ATTR>(
-            Collections::DeserializeU64(bytes, iter)
-          );
-        }
-        case ByteCode::NOP: {
-          return MakeInst<ByteCode::NOP>();
-        }
-        case ByteCode::UNARY_POSITIVE: {
-          return MakeInst<ByteCode::UNARY_POSITIVE>();
-        }
-        case ByteCode::UNARY_NEGATIVE: {
-          return MakeInst<ByteCode::UNARY_NEGATIVE>();
-        }
-        case ByteCode::UNARY_NOT: {
-          return MakeInst<ByteCode::UNARY_NOT>();
-        }
-        case ByteCode::UNARY_INVERT: {
-          return MakeInst<ByteCode::UNARY_INVERT>();
-        }
-        case ByteCode::BINARY_POWER: {
-          return MakeInst<ByteCode::BINARY_POWER>();
-        }
-        case ByteCode::BINARY_MODULO: {
-          return MakeInst<ByteCode::BINARY_MODULO>();
-        }
-        case ByteCode::BINARY_FLOOR_DIVIDE: {
-          return MakeInst<ByteCode::BINARY_FLOOR_DIVIDE>();
-        }
-        case ByteCode::BINARY_TRUE_DIVIDE: {
-          return MakeInst<ByteCode::BINARY_TRUE_DIVIDE>();
-        }
-        case ByteCode::BINARY_LSHIFT: {
-          return MakeInst<ByteCode::BINARY_LSHIFT>();
-        }
-        case ByteCode::BINARY_RSHIFT: {
-          return MakeInst<ByteCode::BINARY_RSHIFT>();
-        }
-        case ByteCode::BINARY_AND: {
-          return MakeInst<ByteCode::BINARY_AND>();
-        }
-        case ByteCode::BINARY_XOR: {
-          return MakeInst<ByteCode::BINARY_XOR>();
-        }
-        case ByteCode::BINARY_OR: {
-          return MakeInst<ByteCode::BINARY_OR>();
-        }
-        case ByteCode::YIELD_VALUE: {
-          return MakeInst<ByteCode::YIELD_VALUE>();
-        }
-        case ByteCode::JUMP_FORWARD: {
-          return MakeInst<ByteCode::JUMP_FORWARD>(
-            Collections::DeserializeU64(bytes, iter)
-          );
-        }
-        case ByteCode::STORE_GLOBAL: {
-          return MakeInst<ByteCode::STORE_GLOBAL>(
-            Collections::DeserializeU64(bytes, iter)
-          );
-        }
-      }
-    }());
-  }
-  code->SetInstructions(std::move(insts));
-}
-
 PyObjPtr FrameKlass::repr(const PyObjPtr& obj) {
   if (!obj->is(FrameKlass::Self())) {
     throw std::runtime_error("repr(): klass is not a frame");
@@ -323,7 +212,7 @@ PyObjPtr FrameKlass::repr(const PyObjPtr& obj) {
   return StringConcat(
     PyList::Create<Object::PyObjPtr>(
       {PyString::Create("<frame object at "),
-       Function::Identity(PyList::Create({obj})), PyString::Create(">")}
+       Function::Identity(nullptr, &obj, 1), PyString::Create(">")}
     )
   );
 }
@@ -404,472 +293,1398 @@ bool PyFrame::HasCaller() const {
   return caller != nullptr;
 }
 
-PyObjPtr PyFrame::Eval() {  // NOLINT(readability-function-cognitive-complexity)
-  while (!Finished()) {
-    auto inst = Instruction();
-    auto byteCode = inst->Code();
-    auto oprt = inst->Operand();
-    if (Config::has("verbose")) {
-      PrintFrame(shared_from_this()->as<PyFrame>());
+/*
+ * 解释循环的分发方式：GCC/Clang 下使用标签地址（computed goto）做直接线索化分发，
+ * 每条指令执行完后直接跳到下一条指令的处理代码；其他编译器退回到 switch。
+ * 可以在编译时定义 KAUBO_COMPUTED_GOTO=0 强制使用 switch 版本。
+ */
+#ifndef KAUBO_COMPUTED_GOTO
+#if defined(__GNUC__) || defined(__clang__)
+#define KAUBO_COMPUTED_GOTO 1
+#else
+#define KAUBO_COMPUTED_GOTO 0
+#endif
+#endif
+
+#if KAUBO_COMPUTED_GOTO
+#define TARGET(op) TARGET_##op:
+/*
+ * 用 goto* 直接离开处理代码的作用域时不会析构其中的局部变量，
+ * 所以先用普通 goto 回到循环顶部的 dispatch 再分发；
+ * 编译器会把这次间接跳转复制回各条指令的末尾
+ */
+#define DISPATCH() goto dispatch
+#else
+#define TARGET(op) case ByteCode::op:
+#define DISPATCH() continue
+#endif
+
+/*
+ * 自适应特化：通用指令每执行一次预热计数减一，耗尽时按栈顶两个操作数的类型
+ * 改写成特化指令并重新分发当前指令；特化指令的类型检查失败时改写回通用指令
+ * 并重新分发。两者都不移动程序计数器，也不改动操作数栈。
+ */
+#define ADAPTIVE_SPECIALIZE()                                    \
+  if (--counters[frame->programCounter] == 0 &&                  \
+      TrySpecialize(                                             \
+        instructions[frame->programCounter],                     \
+        counters[frame->programCounter], frame->stack.Top(2)[0], \
+        frame->stack.Top(2)[1]                                   \
+      )) {                                                       \
+    DISPATCH();                                                  \
+  }
+/*
+ * 切换到 frame 后重新取出该帧 code 的指令流、各类缓存和常量表。
+ * 用宏而不是 lambda，避免这些热路径上的局部变量因被引用捕获而无法留在寄存器中
+ */
+#define ENTER_CODE()                               \
+  do {                                             \
+    const auto& tables = frame->code->Tables();    \
+    instructions = tables.instructions;            \
+    counters = tables.counters;                    \
+    globalCaches = tables.globalCaches;            \
+    nameCaches = tables.nameCaches;                \
+    attrCaches = tables.attrCaches;                \
+    attrCacheSlots = tables.attrCacheSlots;        \
+    consts = tables.consts;                        \
+    names = tables.names;                          \
+    instCount = tables.instCount;                  \
+  } while (false)
+/*
+ * 在本循环内调用的帧返回：切回调用方帧，返回值压入调用方的栈
+ */
+#define RETURN_TO_CALLER(value)                              \
+  do {                                                       \
+    auto* callerFrame = frame->caller.get();                 \
+    Runtime::VirtualMachine::Instance().BackToParentFrame(); \
+    inlineDepth--;                                           \
+    frame = callerFrame;                                     \
+    frame->stack.Push(value);                                \
+    ENTER_CODE();                                            \
+  } while (false)
+/*
+ * 在本循环内进入 Python 函数：receiver（可为空）和 args 起的 count 个参数
+ * 直接从栈上移入新帧，弹出 windowSize 个槽位的调用窗口后切到新帧继续分发。
+ * args 前一个槽位属于调用窗口且已用完，receiver 放在那里与参数连成一段。
+ * 新帧由虚拟机的帧链持有
+ */
+#define ENTER_PY_FUNCTION(target, receiver, args, count, windowSize) \
+  do {                                                               \
+    PyObjPtr* first = (args);                                        \
+    Index total = (count);                                           \
+    if ((receiver) != nullptr) {                                     \
+      --first;                                                       \
+      *first = std::move(receiver);                                  \
+      total++;                                                       \
+    }                                                                \
+    frame->NextProgramCounter();                                     \
+    auto callee = CreateFrameWithPyFunction(target, first, total);   \
+    frame->stack.Drop(windowSize);                                   \
+    frame = callee.get();                                            \
+    Runtime::GarbageCollector::Instance().MaybeCollect();            \
+    inlineDepth++;                                                   \
+    ENTER_CODE();                                                    \
+  } while (false)
+#define DEOPTIMIZE(op)                                         \
+  {                                                            \
+    instructions[frame->programCounter].code = ByteCode::op;   \
+    counters[frame->programCounter] = ADAPTIVE_BACKOFF;        \
+    DISPATCH();                                                \
+  }
+
+namespace {
+
+/**
+ * @brief 按比较运算符把 less / equal 的结果组合成最终结果
+ * @details 与 Klass 中 gt/ge/le/ne 的默认实现保持一致
+ */
+template <typename Less, typename Equal>
+bool DecideCompare(CompareOp compareOp, const Less& less, const Equal& equal) {
+  switch (compareOp) {
+    case CompareOp::LESS_THAN:
+      return less();
+    case CompareOp::LESS_THAN_EQUAL:
+      return less() || equal();
+    case CompareOp::GREATER_THAN:
+      return !(less() || equal());
+    case CompareOp::GREATER_THAN_EQUAL:
+      return !less();
+    case CompareOp::EQUAL:
+      return equal();
+    case CompareOp::NOT_EQUAL:
+      return !equal();
+    default:
+      throw std::runtime_error("Unknown compare operation");
+  }
+}
+
+/**
+ * @brief COMPARE_AND_BRANCH 使用的比较，结果直接以 bool 返回
+ * @details 整数和浮点数直接比较原生值，不构造 PyBoolean；
+ * 其他类型退回到对象协议
+ */
+bool CompareToBool(
+  CompareOp compareOp,
+  const PyObjPtr& left,
+  const PyObjPtr& right
+) {
+  switch (compareOp) {
+    case CompareOp::IS:
+      return left.get() == right.get();
+    case CompareOp::IS_NOT:
+      return left.get() != right.get();
+    case CompareOp::IN:
+      return IsTrue(right->contains(left));
+    case CompareOp::NOT_IN:
+      return !IsTrue(right->contains(left));
+    default:
+      break;
+  }
+  if (left->is(IntegerKlass::Self()) && right->is(IntegerKlass::Self())) {
+    auto lhs = left->unchecked_as<PyInteger>();
+    return DecideCompare(
+      compareOp, [&lhs, &right] { return lhs->LessThan(right); },
+      [&lhs, &right] { return lhs->Equal(right); }
+    );
+  }
+  if (left->is(FloatKlass::Self()) && right->is(FloatKlass::Self())) {
+    const double lhs = left->unchecked_as<PyFloat>()->Value();
+    const double rhs = right->unchecked_as<PyFloat>()->Value();
+    return DecideCompare(
+      compareOp, [lhs, rhs] { return lhs < rhs; },
+      [lhs, rhs] { return lhs == rhs; }
+    );
+  }
+  switch (compareOp) {
+    case CompareOp::LESS_THAN:
+      return IsTrue(left->lt(right));
+    case CompareOp::LESS_THAN_EQUAL:
+      return IsTrue(left->le(right));
+    case CompareOp::GREATER_THAN:
+      return IsTrue(left->gt(right));
+    case CompareOp::GREATER_THAN_EQUAL:
+      return IsTrue(left->ge(right));
+    case CompareOp::EQUAL:
+      return IsTrue(left->eq(right));
+    case CompareOp::NOT_EQUAL:
+      return IsTrue(left->ne(right));
+    default:
+      throw std::runtime_error("Unknown compare operation");
+  }
+}
+
+/**
+ * @brief 按栈顶操作数的类型为通用指令挑选特化形式，没有合适的特化时返回原指令
+ */
+ByteCode SpecializationOf(
+  const Inst& inst,
+  const PyObjPtr& left,
+  const PyObjPtr& right
+) {
+  const bool ints =
+    left->is(IntegerKlass::Self()) && right->is(IntegerKlass::Self());
+  const bool floats =
+    left->is(FloatKlass::Self()) && right->is(FloatKlass::Self());
+  switch (inst.code) {
+    case ByteCode::BINARY_ADD:
+      if (ints) {
+        return ByteCode::BINARY_ADD_INT;
+      }
+      if (floats) {
+        return ByteCode::BINARY_ADD_FLOAT;
+      }
+      if (left->is(StringKlass::Self()) && right->is(StringKlass::Self())) {
+        return ByteCode::BINARY_ADD_STR;
+      }
+      break;
+    case ByteCode::BINARY_SUBTRACT:
+      if (ints) {
+        return ByteCode::BINARY_SUBTRACT_INT;
+      }
+      if (floats) {
+        return ByteCode::BINARY_SUBTRACT_FLOAT;
+      }
+      break;
+    case ByteCode::BINARY_MULTIPLY:
+      if (ints) {
+        return ByteCode::BINARY_MULTIPLY_INT;
+      }
+      if (floats) {
+        return ByteCode::BINARY_MULTIPLY_FLOAT;
+      }
+      break;
+    case ByteCode::BINARY_SUBSCR:
+      if (left->is(ListKlass::Self()) && right->is(IntegerKlass::Self())) {
+        return ByteCode::BINARY_SUBSCR_LIST_INT;
+      }
+      break;
+    case ByteCode::COMPARE_OP:
+      if (ints &&
+          static_cast<CompareOp>(inst.operand) == CompareOp::LESS_THAN) {
+        return ByteCode::COMPARE_LT_INT;
+      }
+      break;
+    default:
+      break;
+  }
+  return inst.code;
+}
+
+/**
+ * @brief 预热计数耗尽时尝试特化，成功则原地改写指令，失败则进入退避
+ */
+bool TrySpecialize(
+  Inst& inst,
+  uint8_t& counter,
+  const PyObjPtr& left,
+  const PyObjPtr& right
+) {
+  auto specialized = SpecializationOf(inst, left, right);
+  if (specialized == inst.code) {
+    counter = ADAPTIVE_BACKOFF;
+    return false;
+  }
+  inst.code = specialized;
+  return true;
+}
+
+/**
+ * @brief 在内联缓存中找到 klass 对应的项，没有时按轮转顺序让出一项
+ */
+AttrCacheEntry& AttrCacheEntryOf(AttrCache& cache, KlassPtr klass) {
+  for (auto& entry : cache.entries) {
+    if (entry.klass == klass) {
+      return entry;
     }
-    switch (byteCode) {
-      case ByteCode::LOAD_CONST: {
-        auto key = std::get<Index>(oprt);
-        auto value = Code()->Consts()->getitem(PyInteger::Create(key));
-        stack.Push(value);
-        NextProgramCounter();
-        break;
+  }
+  auto& victim = cache.entries[cache.next];
+  cache.next = (cache.next + 1) % AttrCache::WAYS;
+  return victim;
+}
+
+/**
+ * @brief 类及其基类是否重载了 name 对应的属性访问钩子
+ */
+bool HasAttrHook(const PyObjPtr& obj, const char* name) {
+  return GetAttr(obj, PyString::Create(name)->as<PyString>()) != nullptr;
+}
+
+/**
+ * @brief 为 LOAD_ATTR 解析一次属性所在的位置
+ * @details 与 Klass::getattr 的查找顺序一致：先实例属性，再类和 MRO。
+ * 重载了 __getattr__ 的类、以及类上的 Iife 属性不缓存，返回 false
+ */
+bool ResolveAttr(
+  const PyObjPtr& obj,
+  const PyObjPtr& key,
+  AttrCacheEntry& entry
+) {
+  if (HasAttrHook(obj, "__getattr__")) {
+    return false;
+  }
+  auto* klass = obj->Klass();
+  entry.klass = klass;
+  entry.version = klass->Version();
+  auto* instance = obj->AsInstance();
+  entry.shape = instance == nullptr ? nullptr : instance->GetShape();
+  if (obj->TryGetOwnAttribute(key) != nullptr) {
+    entry.kind = AttrCacheEntry::Kind::INSTANCE;
+    entry.value = nullptr;
+    if (entry.shape != nullptr) {
+      entry.slot = entry.shape->Find(key);
+    }
+    return true;
+  }
+  auto value = GetAttr(obj, key->as<PyString>());
+  if (value == nullptr || value->is(IifeKlass::Self())) {
+    entry.klass = nullptr;
+    return false;
+  }
+  entry.kind = value->is(FunctionKlass::Self()) ||
+                   value->is(NativeFunctionKlass::Self())
+                 ? AttrCacheEntry::Kind::METHOD
+                 : AttrCacheEntry::Kind::CLASS_ATTR;
+  entry.value = std::move(value);
+  return true;
+}
+
+/**
+ * @brief 实例自身的属性，形状与缓存记录的一致时不必查找
+ */
+PyObjPtr CachedOwnAttribute(
+  const AttrCacheEntry& entry,
+  const PyObjPtr& obj,
+  const PyObjPtr& key
+) {
+  auto* instance = obj->AsInstance();
+  if (instance == nullptr) {
+    return nullptr;
+  }
+  if (entry.shape != nullptr && instance->GetShape() == entry.shape) {
+    return entry.kind == AttrCacheEntry::Kind::INSTANCE
+             ? instance->SlotAt(entry.slot)
+             : nullptr;
+  }
+  return instance->GetOwnAttribute(key);
+}
+
+/**
+ * @brief 按缓存的结论取属性，对当前对象不成立时返回 nullptr
+ * @details 类上的属性可能被实例自身的同名属性遮蔽，所以仍要查一次实例属性
+ */
+PyObjPtr ApplyAttrCache(
+  const AttrCacheEntry& entry,
+  const PyObjPtr& obj,
+  const PyObjPtr& key
+) {
+  auto own = CachedOwnAttribute(entry, obj, key);
+  switch (entry.kind) {
+    case AttrCacheEntry::Kind::INSTANCE:
+      if (own != nullptr && own->is(IifeKlass::Self())) {
+        return own->as<PyIife>()->Call(PyList::Create({obj}));
       }
-      case ByteCode::STORE_GLOBAL: {
-        auto key = std::get<Index>(oprt);
-        auto value = stack.Pop();
-        globals->setitem(PyInteger::Create(key), value);
-        NextProgramCounter();
+      return own;
+    case AttrCacheEntry::Kind::CLASS_ATTR:
+      return own == nullptr ? entry.value : nullptr;
+    case AttrCacheEntry::Kind::METHOD:
+      return own == nullptr ? PyMethod::Create(obj, entry.value) : nullptr;
+  }
+  return nullptr;
+}
+
+/**
+ * @brief 带内联缓存的 LOAD_ATTR，无法走缓存时返回 nullptr，
+ * 由调用方退回 Klass::getattr
+ */
+PyObjPtr LoadAttrCached(
+  AttrCache& cache,
+  const PyObjPtr& obj,
+  const PyObjPtr& key
+) {
+  auto* klass = obj->Klass();
+  auto& entry = AttrCacheEntryOf(cache, klass);
+  if (entry.klass == klass && entry.version == klass->Version()) {
+    auto value = ApplyAttrCache(entry, obj, key);
+    if (value != nullptr) {
+      return value;
+    }
+  }
+  if (!ResolveAttr(obj, key, entry)) {
+    return nullptr;
+  }
+  return ApplyAttrCache(entry, obj, key);
+}
+
+/**
+ * @brief 带内联缓存的 LOAD_METHOD
+ * @details 属性是类上的函数且没有被实例属性遮蔽时返回这个未绑定的函数，
+ * 并把 bound 置为 true，由调用方把对象作为 self 一起压栈；其余情况返回
+ * 属性值本身。无法走缓存时返回 nullptr，由调用方退回 Klass::getattr
+ */
+PyObjPtr LoadMethodCached(
+  AttrCache& cache,
+  const PyObjPtr& obj,
+  const PyObjPtr& key,
+  bool& bound
+) {
+  auto* klass = obj->Klass();
+  auto& entry = AttrCacheEntryOf(cache, klass);
+  if ((entry.klass != klass || entry.version != klass->Version()) &&
+      !ResolveAttr(obj, key, entry)) {
+    return nullptr;
+  }
+  if (entry.kind == AttrCacheEntry::Kind::METHOD &&
+      CachedOwnAttribute(entry, obj, key) == nullptr) {
+    bound = true;
+    return entry.value;
+  }
+  return ApplyAttrCache(entry, obj, key);
+}
+
+/**
+ * @brief 输出对象和类的属性后抛出 AttributeError
+ */
+[[noreturn]] void ThrowAttributeError(
+  const PyObjPtr& obj,
+  const PyObjPtr& key
+) {
+  auto* instance = obj->AsInstance();
+  if (instance != nullptr) {
+    ConsoleTerminal::get_instance().debug("object attributes: ");
+    instance->AttributeDict()->str()->as<PyString>()->Print();
+  }
+  ConsoleTerminal::get_instance().debug("class attributes: ");
+  obj->Klass()->Attributes()->str()->as<PyString>()->Print();
+  ConsoleTerminal::get_instance().debug("mro: ");
+  obj->Klass()->Mro()->str()->as<PyString>()->Print();
+  for (Index i = 0; i < obj->Klass()->Mro()->Length(); i++) {
+    auto mro = obj->Klass()->Mro()->GetItem(i)->as<PyType>();
+    mro->Owner()->Name()->str()->as<PyString>()->Print();
+    mro->str()->as<PyString>()->Print();
+  }
+  throw std::runtime_error(
+    "AttributeError: '" + obj->Klass()->Name()->as<PyString>()->ToCppString() +
+    "' object has no attribute '" + key->as<PyString>()->ToCppString() + "'"
+  );
+}
+
+/**
+ * @brief 可以在当前解释循环内执行的调用目标
+ * @details 普通 Python 函数和绑定了 self 的 Python 方法返回对应的函数，
+ * 方法的 self 写入 self；生成器函数、原生函数和类型返回 nullptr，
+ * 仍交给 InvokeCallable
+ */
+PyFunctionPtr InlineCallTarget(const PyObjPtr& func, PyObjPtr& self) {
+  if (func->is(FunctionKlass::Self())) {
+    auto function = StaticRefCast<PyFunction>(func);
+    return function->Code()->IsGenerator() ? nullptr : function;
+  }
+  if (!func->is(MethodKlass::Self())) {
+    return nullptr;
+  }
+  auto method = StaticRefCast<PyMethod>(func);
+  auto target = method->Method();
+  if (!target->is(FunctionKlass::Self())) {
+    return nullptr;
+  }
+  auto function = StaticRefCast<PyFunction>(target);
+  if (function->Code()->IsGenerator()) {
+    return nullptr;
+  }
+  self = method->Owner();
+  return function;
+}
+
+/**
+ * @brief 带内联缓存的 STORE_ATTR，类对象、没有实例字典的值对象和重载了
+ * __setattr__ 的类不走缓存，返回 false 由调用方退回 Klass::setattr
+ * @details 实例的形状与上次写入前相同时，直接写入记录的槽位，
+ * 或者按记录的转移追加一个槽位
+ */
+bool StoreAttrCached(
+  AttrCache& cache,
+  const PyObjPtr& obj,
+  const PyObjPtr& key,
+  const PyObjPtr& value
+) {
+  auto* instance = obj->AsInstance();
+  if (instance == nullptr) {
+    return false;
+  }
+  auto* klass = obj->Klass();
+  auto& entry = AttrCacheEntryOf(cache, klass);
+  if (entry.klass != klass || entry.version != klass->Version()) {
+    if (klass == TypeKlass::Self() || HasAttrHook(obj, "__setattr__")) {
+      return false;
+    }
+    entry.klass = klass;
+    entry.version = klass->Version();
+    entry.shape = nullptr;
+  }
+  auto* shape = instance->GetShape();
+  if (shape != nullptr && shape == entry.shape) {
+    if (entry.nextShape == shape) {
+      instance->SlotAt(entry.slot) = value;
+    } else {
+      instance->AppendSlot(entry.nextShape, value);
+    }
+    return true;
+  }
+  instance->SetOwnAttribute(key, value);
+  entry.nextShape = instance->GetShape();
+  entry.shape = entry.nextShape == nullptr ? nullptr : shape;
+  if (entry.shape != nullptr) {
+    entry.slot = entry.nextShape->Find(key);
+  }
+  return true;
+}
+
+}  // namespace
+
+PyObjPtr PyFrame::Eval() {
+  // verbose 只在进入帧时查询一次，决定使用带跟踪输出的解释循环
+  if (Config::has("verbose")) {
+    return EvalLoop<true>(this);
+  }
+  return EvalLoop<false>(this);
+}
+
+#if KAUBO_COMPUTED_GOTO
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+#endif
+
+template <bool Tracing>
+PyObjPtr PyFrame::EvalLoop(  // NOLINT(readability-function-cognitive-complexity)
+  PyFrame* entry
+) {
+  // 当前执行的帧，以及在本循环内进入、尚未返回的调用层数
+  PyFrame* frame = entry;
+  Index inlineDepth = 0;
+  Inst* instructions = nullptr;
+  uint8_t* counters = nullptr;
+  NameCache* globalCaches = nullptr;
+  NameCache* nameCaches = nullptr;
+  AttrCache* attrCaches = nullptr;
+  const Index* attrCacheSlots = nullptr;
+  const PyObjPtr* consts = nullptr;
+  const PyObjPtr* names = nullptr;
+  Index instCount = 0;
+  ENTER_CODE();
+  const auto& builtins = Runtime::VirtualMachine::Instance().Builtins();
+  Inst inst{};
+  uint32_t oprt = 0;
+#if KAUBO_COMPUTED_GOTO
+  static void* dispatchTable[256];
+  static bool dispatchTableReady = false;
+  if (!dispatchTableReady) {
+    std::fill(
+      std::begin(dispatchTable), std::end(dispatchTable), &&TARGET_UNKNOWN
+    );
+    dispatchTable[static_cast<uint8_t>(ByteCode::LOAD_CONST)] =
+      &&TARGET_LOAD_CONST;
+    dispatchTable[static_cast<uint8_t>(ByteCode::STORE_GLOBAL)] =
+      &&TARGET_STORE_GLOBAL;
+    dispatchTable[static_cast<uint8_t>(ByteCode::STORE_FAST)] =
+      &&TARGET_STORE_FAST;
+    dispatchTable[static_cast<uint8_t>(ByteCode::COMPARE_OP)] =
+      &&TARGET_COMPARE_OP;
+    dispatchTable[static_cast<uint8_t>(ByteCode::POP_JUMP_IF_FALSE)] =
+      &&TARGET_POP_JUMP_IF_FALSE;
+    dispatchTable[static_cast<uint8_t>(ByteCode::POP_JUMP_IF_TRUE)] =
+      &&TARGET_POP_JUMP_IF_TRUE;
+    dispatchTable[static_cast<uint8_t>(ByteCode::BINARY_ADD)] =
+      &&TARGET_BINARY_ADD;
+    dispatchTable[static_cast<uint8_t>(ByteCode::BINARY_SUBTRACT)] =
+      &&TARGET_BINARY_SUBTRACT;
+    dispatchTable[static_cast<uint8_t>(ByteCode::BINARY_MULTIPLY)] =
+      &&TARGET_BINARY_MULTIPLY;
+    dispatchTable[static_cast<uint8_t>(ByteCode::BINARY_MATRIX_MULTIPLY)] =
+      &&TARGET_BINARY_MATRIX_MULTIPLY;
+    dispatchTable[static_cast<uint8_t>(ByteCode::BINARY_TRUE_DIVIDE)] =
+      &&TARGET_BINARY_TRUE_DIVIDE;
+    dispatchTable[static_cast<uint8_t>(ByteCode::BINARY_FLOOR_DIVIDE)] =
+      &&TARGET_BINARY_FLOOR_DIVIDE;
+    dispatchTable[static_cast<uint8_t>(ByteCode::BINARY_XOR)] =
+      &&TARGET_BINARY_XOR;
+    dispatchTable[static_cast<uint8_t>(ByteCode::BINARY_AND)] =
+      &&TARGET_BINARY_AND;
+    dispatchTable[static_cast<uint8_t>(ByteCode::BINARY_OR)] =
+      &&TARGET_BINARY_OR;
+    dispatchTable[static_cast<uint8_t>(ByteCode::BINARY_POWER)] =
+      &&TARGET_BINARY_POWER;
+    dispatchTable[static_cast<uint8_t>(ByteCode::BINARY_MODULO)] =
+      &&TARGET_BINARY_MODULO;
+    dispatchTable[static_cast<uint8_t>(ByteCode::BINARY_LSHIFT)] =
+      &&TARGET_BINARY_LSHIFT;
+    dispatchTable[static_cast<uint8_t>(ByteCode::BINARY_RSHIFT)] =
+      &&TARGET_BINARY_RSHIFT;
+    dispatchTable[static_cast<uint8_t>(ByteCode::UNARY_POSITIVE)] =
+      &&TARGET_UNARY_POSITIVE;
+    dispatchTable[static_cast<uint8_t>(ByteCode::UNARY_NEGATIVE)] =
+      &&TARGET_UNARY_NEGATIVE;
+    dispatchTable[static_cast<uint8_t>(ByteCode::UNARY_NOT)] =
+      &&TARGET_UNARY_NOT;
+    dispatchTable[static_cast<uint8_t>(ByteCode::UNARY_INVERT)] =
+      &&TARGET_UNARY_INVERT;
+    dispatchTable[static_cast<uint8_t>(ByteCode::BINARY_SUBSCR)] =
+      &&TARGET_BINARY_SUBSCR;
+    dispatchTable[static_cast<uint8_t>(ByteCode::RETURN_VALUE)] =
+      &&TARGET_RETURN_VALUE;
+    dispatchTable[static_cast<uint8_t>(ByteCode::MAKE_FUNCTION)] =
+      &&TARGET_MAKE_FUNCTION;
+    dispatchTable[static_cast<uint8_t>(ByteCode::LOAD_FAST)] =
+      &&TARGET_LOAD_FAST;
+    dispatchTable[static_cast<uint8_t>(ByteCode::CALL_FUNCTION)] =
+      &&TARGET_CALL_FUNCTION;
+    dispatchTable[static_cast<uint8_t>(ByteCode::LOAD_METHOD)] =
+      &&TARGET_LOAD_METHOD;
+    dispatchTable[static_cast<uint8_t>(ByteCode::CALL_METHOD)] =
+      &&TARGET_CALL_METHOD;
+    dispatchTable[static_cast<uint8_t>(ByteCode::LOAD_GLOBAL)] =
+      &&TARGET_LOAD_GLOBAL;
+    dispatchTable[static_cast<uint8_t>(ByteCode::STORE_NAME)] =
+      &&TARGET_STORE_NAME;
+    dispatchTable[static_cast<uint8_t>(ByteCode::LOAD_NAME)] =
+      &&TARGET_LOAD_NAME;
+    dispatchTable[static_cast<uint8_t>(ByteCode::POP_TOP)] =
+      &&TARGET_POP_TOP;
+    dispatchTable[static_cast<uint8_t>(ByteCode::LOAD_ATTR)] =
+      &&TARGET_LOAD_ATTR;
+    dispatchTable[static_cast<uint8_t>(ByteCode::BUILD_LIST)] =
+      &&TARGET_BUILD_LIST;
+    dispatchTable[static_cast<uint8_t>(ByteCode::BUILD_SLICE)] =
+      &&TARGET_BUILD_SLICE;
+    dispatchTable[static_cast<uint8_t>(ByteCode::JUMP_ABSOLUTE)] =
+      &&TARGET_JUMP_ABSOLUTE;
+    dispatchTable[static_cast<uint8_t>(ByteCode::STORE_SUBSCR)] =
+      &&TARGET_STORE_SUBSCR;
+    dispatchTable[static_cast<uint8_t>(ByteCode::GET_ITER)] =
+      &&TARGET_GET_ITER;
+    dispatchTable[static_cast<uint8_t>(ByteCode::FOR_ITER)] =
+      &&TARGET_FOR_ITER;
+    dispatchTable[static_cast<uint8_t>(ByteCode::LOAD_BUILD_CLASS)] =
+      &&TARGET_LOAD_BUILD_CLASS;
+    dispatchTable[static_cast<uint8_t>(ByteCode::STORE_ATTR)] =
+      &&TARGET_STORE_ATTR;
+    dispatchTable[static_cast<uint8_t>(ByteCode::NOP)] =
+      &&TARGET_NOP;
+    dispatchTable[static_cast<uint8_t>(ByteCode::YIELD_VALUE)] =
+      &&TARGET_YIELD_VALUE;
+    dispatchTable[static_cast<uint8_t>(ByteCode::JUMP_FORWARD)] =
+      &&TARGET_JUMP_FORWARD;
+    dispatchTable[static_cast<uint8_t>(ByteCode::BUILD_MAP)] =
+      &&TARGET_BUILD_MAP;
+    dispatchTable[static_cast<uint8_t>(ByteCode::LOAD_FAST_LOAD_FAST)] =
+      &&TARGET_LOAD_FAST_LOAD_FAST;
+    dispatchTable[static_cast<uint8_t>(ByteCode::INCREMENT_FAST_CONST)] =
+      &&TARGET_INCREMENT_FAST_CONST;
+    dispatchTable[static_cast<uint8_t>(ByteCode::COMPARE_AND_BRANCH)] =
+      &&TARGET_COMPARE_AND_BRANCH;
+    dispatchTable[static_cast<uint8_t>(ByteCode::BINARY_ADD_INT)] =
+      &&TARGET_BINARY_ADD_INT;
+    dispatchTable[static_cast<uint8_t>(ByteCode::BINARY_ADD_FLOAT)] =
+      &&TARGET_BINARY_ADD_FLOAT;
+    dispatchTable[static_cast<uint8_t>(ByteCode::BINARY_ADD_STR)] =
+      &&TARGET_BINARY_ADD_STR;
+    dispatchTable[static_cast<uint8_t>(ByteCode::BINARY_SUBTRACT_INT)] =
+      &&TARGET_BINARY_SUBTRACT_INT;
+    dispatchTable[static_cast<uint8_t>(ByteCode::BINARY_SUBTRACT_FLOAT)] =
+      &&TARGET_BINARY_SUBTRACT_FLOAT;
+    dispatchTable[static_cast<uint8_t>(ByteCode::BINARY_MULTIPLY_INT)] =
+      &&TARGET_BINARY_MULTIPLY_INT;
+    dispatchTable[static_cast<uint8_t>(ByteCode::BINARY_MULTIPLY_FLOAT)] =
+      &&TARGET_BINARY_MULTIPLY_FLOAT;
+    dispatchTable[static_cast<uint8_t>(ByteCode::BINARY_SUBSCR_LIST_INT)] =
+      &&TARGET_BINARY_SUBSCR_LIST_INT;
+    dispatchTable[static_cast<uint8_t>(ByteCode::COMPARE_LT_INT)] =
+      &&TARGET_COMPARE_LT_INT;
+    dispatchTableReady = true;
+  }
+dispatch:
+  if (frame->programCounter >= instCount) {
+    goto exit;
+  }
+  inst = instructions[frame->programCounter];
+  oprt = inst.operand;
+  if constexpr (Tracing) {
+    PrintFrame(PyFramePtr(frame));
+  }
+  goto* dispatchTable[static_cast<uint8_t>(inst.code)];
+#else
+  for (;;) {
+    if (frame->programCounter >= instCount) {
+      // 指令流执行完而没有遇到 RETURN_VALUE，按返回 None 处理
+      if (inlineDepth == 0) {
         break;
       }
-      case ByteCode::STORE_FAST: {
-        auto index = std::get<Index>(oprt);
-        auto value = stack.Pop();
-        fastLocals->setitem(PyInteger::Create(index), value);
-        NextProgramCounter();
-        break;
+      RETURN_TO_CALLER(PyNone::Create());
+      continue;
+    }
+    inst = instructions[frame->programCounter];
+    oprt = inst.operand;
+    if constexpr (Tracing) {
+      PrintFrame(PyFramePtr(frame));
+    }
+    switch (inst.code) {
+#endif
+      TARGET(LOAD_CONST) {
+        frame->stack.Push(consts[oprt]);
+        frame->NextProgramCounter();
+        DISPATCH();
       }
-      case ByteCode::COMPARE_OP: {
-        auto compareOp = std::get<CompareOp>(oprt);
-        auto right = stack.Pop();
-        auto left = stack.Pop();
+      TARGET(STORE_GLOBAL) {
+        auto value = frame->stack.Pop();
+        frame->globals->setitem(names[oprt], value);
+        frame->NextProgramCounter();
+        DISPATCH();
+      }
+      TARGET(STORE_FAST) {
+        frame->fastLocals[oprt] = frame->stack.Pop();
+        frame->NextProgramCounter();
+        DISPATCH();
+      }
+      TARGET(COMPARE_OP) {
+        ADAPTIVE_SPECIALIZE();
+        auto compareOp = static_cast<CompareOp>(oprt);
+        auto right = frame->stack.Pop();
+        auto left = frame->stack.Pop();
         switch (compareOp) {
           case CompareOp::EQUAL: {
-            stack.Push(left->eq(right));
+            frame->stack.Push(left->eq(right));
             break;
           }
           case CompareOp::NOT_EQUAL: {
-            stack.Push(left->ne(right));
+            frame->stack.Push(left->ne(right));
             break;
           }
           case CompareOp::LESS_THAN: {
-            stack.Push(left->lt(right));
+            frame->stack.Push(left->lt(right));
             break;
           }
           case CompareOp::LESS_THAN_EQUAL: {
-            stack.Push(left->le(right));
+            frame->stack.Push(left->le(right));
             break;
           }
           case CompareOp::GREATER_THAN: {
             auto result = left->gt(right);
-            stack.Push(left->gt(right));
+            frame->stack.Push(left->gt(right));
             break;
           }
           case CompareOp::GREATER_THAN_EQUAL: {
-            stack.Push(left->ge(right));
+            frame->stack.Push(left->ge(right));
             break;
           }
           case CompareOp::IN: {
-            stack.Push(right->contains(left));
+            frame->stack.Push(right->contains(left));
             break;
           }
           case CompareOp::NOT_IN: {
-            stack.Push(Not(right->contains(left)));
+            frame->stack.Push(Not(right->contains(left)));
             break;
           }
           case CompareOp::IS: {
-            stack.Push(PyBoolean::Create(left.get() == right.get()));
+            frame->stack.Push(PyBoolean::Create(left.get() == right.get()));
             break;
           }
           case CompareOp::IS_NOT: {
-            stack.Push(PyBoolean::Create(left.get() != right.get()));
+            frame->stack.Push(PyBoolean::Create(left.get() != right.get()));
             break;
           }
           default:
             throw std::runtime_error("Unknown compare operation");
         }
-        NextProgramCounter();
-        break;
+        frame->NextProgramCounter();
+        DISPATCH();
       }
-      case ByteCode::POP_JUMP_IF_FALSE: {
-        auto needJump = stack.Pop();
+      TARGET(POP_JUMP_IF_FALSE) {
+        auto needJump = frame->stack.Pop();
         if (!IsTrue(needJump)) {
-          SetProgramCounter(
+          frame->SetProgramCounter(
             static_cast<Index>(
-              static_cast<int64_t>(ProgramCounter()) + std::get<int64_t>(oprt)
+              static_cast<int64_t>(frame->programCounter) +
+              static_cast<int32_t>(oprt)
             )
           );
         } else {
-          NextProgramCounter();
+          frame->NextProgramCounter();
         }
-        break;
+        DISPATCH();
       }
-      case ByteCode::POP_JUMP_IF_TRUE: {
-        auto needJump = stack.Pop();
+      TARGET(POP_JUMP_IF_TRUE) {
+        auto needJump = frame->stack.Pop();
         if (IsTrue(needJump)) {
-          SetProgramCounter(
+          frame->SetProgramCounter(
             static_cast<Index>(
-              static_cast<int64_t>(ProgramCounter()) + std::get<int64_t>(oprt)
+              static_cast<int64_t>(frame->programCounter) +
+              static_cast<int32_t>(oprt)
             )
           );
         } else {
-          NextProgramCounter();
+          frame->NextProgramCounter();
         }
-        break;
+        DISPATCH();
       }
-      case ByteCode::BINARY_ADD: {
-        auto right = stack.Pop();
-        auto left = stack.Pop();
-        stack.Push(left->add(right));
-        NextProgramCounter();
-        break;
+      TARGET(BINARY_ADD) {
+        ADAPTIVE_SPECIALIZE();
+        auto right = frame->stack.Pop();
+        auto left = frame->stack.Pop();
+        frame->stack.Push(left->add(right));
+        frame->NextProgramCounter();
+        DISPATCH();
       }
-      case ByteCode::BINARY_SUBTRACT: {
-        auto right = stack.Pop();
-        auto left = stack.Pop();
-        stack.Push(left->sub(right));
-        NextProgramCounter();
-        break;
+      TARGET(BINARY_SUBTRACT) {
+        ADAPTIVE_SPECIALIZE();
+        auto right = frame->stack.Pop();
+        auto left = frame->stack.Pop();
+        frame->stack.Push(left->sub(right));
+        frame->NextProgramCounter();
+        DISPATCH();
       }
-      case ByteCode::BINARY_MULTIPLY: {
-        auto right = stack.Pop();
-        auto left = stack.Pop();
-        stack.Push(left->mul(right));
-        NextProgramCounter();
-        break;
+      TARGET(BINARY_MULTIPLY) {
+        ADAPTIVE_SPECIALIZE();
+        auto right = frame->stack.Pop();
+        auto left = frame->stack.Pop();
+        frame->stack.Push(left->mul(right));
+        frame->NextProgramCounter();
+        DISPATCH();
       }
-      case ByteCode::BINARY_MATRIX_MULTIPLY: {
-        auto right = stack.Pop();
-        auto left = stack.Pop();
-        stack.Push(left->matmul(right));
-        NextProgramCounter();
-        break;
+      TARGET(BINARY_MATRIX_MULTIPLY) {
+        auto right = frame->stack.Pop();
+        auto left = frame->stack.Pop();
+        frame->stack.Push(left->matmul(right));
+        frame->NextProgramCounter();
+        DISPATCH();
       }
-      case ByteCode::BINARY_TRUE_DIVIDE: {
-        auto right = stack.Pop();
-        auto left = stack.Pop();
-        stack.Push(left->truediv(right));
-        NextProgramCounter();
-        break;
+      TARGET(BINARY_TRUE_DIVIDE) {
+        auto right = frame->stack.Pop();
+        auto left = frame->stack.Pop();
+        frame->stack.Push(left->truediv(right));
+        frame->NextProgramCounter();
+        DISPATCH();
       }
-      case ByteCode::BINARY_FLOOR_DIVIDE: {
-        auto right = stack.Pop();
-        auto left = stack.Pop();
-        stack.Push(left->floordiv(right));
-        NextProgramCounter();
-        break;
+      TARGET(BINARY_FLOOR_DIVIDE) {
+        auto right = frame->stack.Pop();
+        auto left = frame->stack.Pop();
+        frame->stack.Push(left->floordiv(right));
+        frame->NextProgramCounter();
+        DISPATCH();
       }
-      case ByteCode::BINARY_XOR: {
-        auto right = stack.Pop();
-        auto left = stack.Pop();
-        stack.Push(left->_xor_(right));
-        NextProgramCounter();
-        break;
+      TARGET(BINARY_XOR) {
+        auto right = frame->stack.Pop();
+        auto left = frame->stack.Pop();
+        frame->stack.Push(left->_xor_(right));
+        frame->NextProgramCounter();
+        DISPATCH();
       }
-      case ByteCode::BINARY_AND: {
-        auto right = stack.Pop();
-        auto left = stack.Pop();
-        stack.Push(left->_and_(right));
-        NextProgramCounter();
-        break;
+      TARGET(BINARY_AND) {
+        auto right = frame->stack.Pop();
+        auto left = frame->stack.Pop();
+        frame->stack.Push(left->_and_(right));
+        frame->NextProgramCounter();
+        DISPATCH();
       }
-      case ByteCode::BINARY_OR: {
-        auto right = stack.Pop();
-        auto left = stack.Pop();
-        stack.Push(left->_or_(right));
-        NextProgramCounter();
-        break;
+      TARGET(BINARY_OR) {
+        auto right = frame->stack.Pop();
+        auto left = frame->stack.Pop();
+        frame->stack.Push(left->_or_(right));
+        frame->NextProgramCounter();
+        DISPATCH();
       }
-      case ByteCode::BINARY_POWER: {
-        auto right = stack.Pop();
-        auto left = stack.Pop();
-        stack.Push(left->pow(right));
-        NextProgramCounter();
-        break;
+      TARGET(BINARY_POWER) {
+        auto right = frame->stack.Pop();
+        auto left = frame->stack.Pop();
+        frame->stack.Push(left->pow(right));
+        frame->NextProgramCounter();
+        DISPATCH();
       }
-      case ByteCode::BINARY_MODULO: {
-        auto right = stack.Pop();
-        auto left = stack.Pop();
-        stack.Push(left->mod(right));
-        NextProgramCounter();
-        break;
+      TARGET(BINARY_MODULO) {
+        auto right = frame->stack.Pop();
+        auto left = frame->stack.Pop();
+        frame->stack.Push(left->mod(right));
+        frame->NextProgramCounter();
+        DISPATCH();
       }
-      case ByteCode::BINARY_LSHIFT: {
-        auto right = stack.Pop();
-        auto left = stack.Pop();
-        stack.Push(left->lshift(right));
-        NextProgramCounter();
-        break;
+      TARGET(BINARY_LSHIFT) {
+        auto right = frame->stack.Pop();
+        auto left = frame->stack.Pop();
+        frame->stack.Push(left->lshift(right));
+        frame->NextProgramCounter();
+        DISPATCH();
       }
-      case ByteCode::BINARY_RSHIFT: {
-        auto right = stack.Pop();
-        auto left = stack.Pop();
-        stack.Push(left->rshift(right));
-        NextProgramCounter();
-        break;
+      TARGET(BINARY_RSHIFT) {
+        auto right = frame->stack.Pop();
+        auto left = frame->stack.Pop();
+        frame->stack.Push(left->rshift(right));
+        frame->NextProgramCounter();
+        DISPATCH();
       }
-      case ByteCode::UNARY_POSITIVE: {
-        auto operand = stack.Pop();
-        stack.Push(operand->pos());
-        NextProgramCounter();
-        break;
+      TARGET(UNARY_POSITIVE) {
+        auto operand = frame->stack.Pop();
+        frame->stack.Push(operand->pos());
+        frame->NextProgramCounter();
+        DISPATCH();
       }
-      case ByteCode::UNARY_NEGATIVE: {
-        auto operand = stack.Pop();
-        stack.Push(operand->neg());
-        NextProgramCounter();
-        break;
+      TARGET(UNARY_NEGATIVE) {
+        auto operand = frame->stack.Pop();
+        frame->stack.Push(operand->neg());
+        frame->NextProgramCounter();
+        DISPATCH();
       }
-      case ByteCode::UNARY_NOT: {
-        auto operand = stack.Pop();
-        stack.Push(Not(operand->boolean()));
-        NextProgramCounter();
-        break;
+      TARGET(UNARY_NOT) {
+        auto operand = frame->stack.Pop();
+        frame->stack.Push(Not(operand->boolean()));
+        frame->NextProgramCounter();
+        DISPATCH();
       }
-      case ByteCode::UNARY_INVERT: {
-        auto operand = stack.Pop();
-        stack.Push(operand->invert());
-        NextProgramCounter();
-        break;
+      TARGET(UNARY_INVERT) {
+        auto operand = frame->stack.Pop();
+        frame->stack.Push(operand->invert());
+        frame->NextProgramCounter();
+        DISPATCH();
       }
-      case ByteCode::BINARY_SUBSCR: {
-        auto index = stack.Pop();
-        auto obj = stack.Pop();
-        stack.Push(obj->getitem(index));
-        NextProgramCounter();
-        break;
+      TARGET(BINARY_SUBSCR) {
+        ADAPTIVE_SPECIALIZE();
+        auto index = frame->stack.Pop();
+        auto obj = frame->stack.Pop();
+        frame->stack.Push(obj->getitem(index));
+        frame->NextProgramCounter();
+        DISPATCH();
       }
-      case ByteCode::RETURN_VALUE: {
-        auto value = stack.Pop();
-        return value;
+      TARGET(RETURN_VALUE) {
+        auto value = frame->stack.Pop();
+        if (inlineDepth == 0) {
+          return value;
+        }
+        RETURN_TO_CALLER(std::move(value));
+        DISPATCH();
       }
-      case ByteCode::MAKE_FUNCTION: {
-        auto name = stack.Pop();
+      TARGET(MAKE_FUNCTION) {
+        auto name = frame->stack.Pop();
         if (!name->is(StringKlass::Self())) {
           throw std::runtime_error("Function name must be string");
         }
-        auto codeObj = stack.Pop();
+        auto codeObj = frame->stack.Pop();
         if (!codeObj->is(CodeKlass::Self())) {
           throw std::runtime_error("Function code must be code object");
         }
-        auto func = CreatePyFunction(codeObj, globals);
-        stack.Push(func);
-        NextProgramCounter();
-        break;
+        auto func = CreatePyFunction(codeObj, frame->globals);
+        frame->stack.Push(func);
+        frame->NextProgramCounter();
+        DISPATCH();
       }
-      case ByteCode::LOAD_FAST: {
-        auto index = std::get<Index>(oprt);
-        auto value = fastLocals->GetItem(index);
-        stack.Push(value);
-        NextProgramCounter();
-        break;
-      }
-      case ByteCode::CALL_FUNCTION: {
-        auto argumentCount = std::get<Index>(oprt);
-        auto argList = PyList::Create(stack.Top(argumentCount));
-        auto func = stack.Pop();
-        auto result = Runtime::Evaluator::InvokeCallable(func, argList);
-        stack.Push(result);
-        NextProgramCounter();
-        break;
+      TARGET(LOAD_FAST) {
+        frame->stack.Push(frame->fastLocals[oprt]);
+        frame->NextProgramCounter();
+        DISPATCH();
       }
-      case ByteCode::LOAD_GLOBAL: {
-        auto index = std::get<Index>(oprt);
-        auto key = Code()->Names()->GetItem(index);
-        bool found = false;
-        PyObjPtr value = PyNone::Create();
-        if (globals->Contains(key)) {
-          found = true;
-          value = globals->getitem(key);
-        }
-        if (!found &&
-            IsTrue(
-              Runtime::VirtualMachine::Instance().Builtins()->contains(key)
-            )) {
-          found = true;
-          value = Runtime::VirtualMachine::Instance().Builtins()->getitem(key);
-        }
-        if (!found) {
-          auto errorMessage = StringConcat(
-            PyList::Create<PyObjPtr>(
-              {PyString::Create("NameError: name '"), key,
-               PyString::Create("' is not defined")}
-            )
+      TARGET(CALL_FUNCTION) {
+        auto argumentCount = Index{oprt};
+        // 被调用对象和参数是栈顶的一段窗口
+        auto window = frame->stack.Top(argumentCount + 1);
+        PyObjPtr self;
+        auto function = InlineCallTarget(window[0], self);
+        if (function == nullptr) {
+          // 其余可调用对象按向量调用约定直接使用栈上的参数
+          auto result = Runtime::Evaluator::Vectorcall(
+            window[0], window.data() + 1, argumentCount
           );
-          throw std::runtime_error(errorMessage->as<PyString>()->ToCppString());
+          frame->stack.Drop(argumentCount + 1);
+          frame->stack.Push(std::move(result));
+          frame->NextProgramCounter();
+          DISPATCH();
         }
-        stack.Push(value);
-        NextProgramCounter();
-        break;
+        ENTER_PY_FUNCTION(
+          function, self, window.data() + 1, argumentCount, argumentCount + 1
+        );
+        DISPATCH();
       }
-      case ByteCode::STORE_NAME: {
-        auto index = std::get<Index>(oprt);
-        auto key = Code()->Names()->GetItem(index);
-        auto value = stack.Pop();
-        locals->setitem(key, value);
-        NextProgramCounter();
-        break;
+      TARGET(CALL_METHOD) {
+        auto argumentCount = Index{oprt};
+        // 栈顶窗口依次是 LOAD_METHOD 压入的可调用对象、self 和参数，
+        // self 为空时就是普通调用
+        auto window = frame->stack.Top(argumentCount + 2);
+        PyObjPtr self = std::move(window[1]);
+        auto function = InlineCallTarget(window[0], self);
+        if (function == nullptr) {
+          auto result =
+            self == nullptr
+              ? Runtime::Evaluator::Vectorcall(
+                  window[0], window.data() + 2, argumentCount
+                )
+              : Runtime::Evaluator::Vectorcall(
+                  window[0], self, window.data() + 2, argumentCount
+                );
+          frame->stack.Drop(argumentCount + 2);
+          frame->stack.Push(std::move(result));
+          frame->NextProgramCounter();
+          DISPATCH();
+        }
+        ENTER_PY_FUNCTION(
+          function, self, window.data() + 2, argumentCount, argumentCount + 2
+        );
+        DISPATCH();
       }
-      case ByteCode::LOAD_NAME: {
-        auto index = std::get<Index>(oprt);
-        auto key = Code()->Names()->GetItem(index);
-        // LEGB rule
-        // local -> enclosing -> global -> built-in
-        bool found = false;
-        PyObjPtr value = PyNone::Create();
-        if (IsTrue(locals->contains(key))) {
-          found = true;
-          value = locals->getitem(key);
+      TARGET(LOAD_GLOBAL) {
+        auto& cache = globalCaches[oprt];
+        if (cache.globalsVersion != frame->globals->Version() ||
+            cache.builtinsVersion != builtins->Version()) {
+          const auto& key = names[oprt];
+          auto* slot = frame->globals->Slot(key);
+          if (slot == nullptr) {
+            slot = builtins->Slot(key);
+          }
+          if (slot == nullptr) {
+            auto errorMessage = StringConcat(
+              PyList::Create<PyObjPtr>(
+                {PyString::Create("NameError: name '"), key,
+                 PyString::Create("' is not defined")}
+              )
+            );
+            throw std::runtime_error(
+              errorMessage->as<PyString>()->ToCppString()
+            );
+          }
+          cache = NameCache{
+            0, frame->globals->Version(), builtins->Version(), slot
+          };
         }
-        if (!found && IsTrue(globals->contains(key))) {
-          found = true;
-          value = globals->getitem(key);
+        frame->stack.Push(*cache.slot);
+        frame->NextProgramCounter();
+        DISPATCH();
+      }
+      TARGET(STORE_NAME) {
+        const auto& key = names[oprt];
+        auto value = frame->stack.Pop();
+        frame->CurrentLocals()->setitem(key, value);
+        frame->NextProgramCounter();
+        DISPATCH();
+      }
+      TARGET(LOAD_NAME) {
+        auto& cache = nameCaches[oprt];
+        const auto& frameLocals = frame->CurrentLocals();
+        if (cache.localsVersion != frameLocals->Version() ||
+            cache.globalsVersion != frame->globals->Version() ||
+            cache.builtinsVersion != builtins->Version()) {
+          const auto& key = names[oprt];
+          // LEGB rule
+          // local -> enclosing -> global -> built-in
+          auto* slot = frameLocals->Slot(key);
+          if (slot == nullptr) {
+            slot = frame->globals->Slot(key);
+          }
+          if (slot == nullptr) {
+            slot = builtins->Slot(key);
+          }
+          if (slot == nullptr) {
+            throw std::runtime_error(
+              "NameError: name '" + key->as<PyString>()->ToCppString() +
+              "' is not defined"
+            );
+          }
+          cache = NameCache{
+            frameLocals->Version(), frame->globals->Version(),
+            builtins->Version(), slot
+          };
         }
-        if (!found &&
-            IsTrue(
-              Runtime::VirtualMachine::Instance().Builtins()->contains(key)
-            )) {
-          found = true;
-          value = Runtime::VirtualMachine::Instance().Builtins()->getitem(key);
+        frame->stack.Push(*cache.slot);
+        frame->NextProgramCounter();
+        DISPATCH();
+      }
+      TARGET(POP_TOP) {
+        frame->stack.Pop();
+        frame->NextProgramCounter();
+        DISPATCH();
+      }
+      TARGET(LOAD_ATTR) {
+        const auto& key = names[oprt];
+        auto obj = frame->stack.Pop();
+        auto value = LoadAttrCached(
+          attrCaches[attrCacheSlots[frame->programCounter]], obj, key
+        );
+        if (value == nullptr) {
+          value = obj->getattr(key);
         }
-        if (!found) {
-          throw std::runtime_error(
-            "NameError: name '" + key->as<PyString>()->ToCppString() +
-            "' is not defined"
-          );
+        if (value == nullptr) {
+          ThrowAttributeError(obj, key);
         }
-        stack.Push(value);
-        NextProgramCounter();
-        break;
-      }
-      case ByteCode::POP_TOP: {
-        stack.Pop();
-        NextProgramCounter();
-        break;
+        frame->stack.Push(value);
+        frame->NextProgramCounter();
+        DISPATCH();
       }
-      case ByteCode::LOAD_ATTR: {
-        auto index = std::get<Index>(oprt);
-        auto key = Code()->Names()->GetItem(index);
-        auto obj = stack.Pop();
-        auto value = obj->getattr(key);
+      TARGET(LOAD_METHOD) {
+        const auto& key = names[oprt];
+        auto obj = frame->stack.Pop();
+        bool bound = false;
+        auto value = LoadMethodCached(
+          attrCaches[attrCacheSlots[frame->programCounter]], obj, key, bound
+        );
         if (value == nullptr) {
-          ConsoleTerminal::get_instance().debug("object attributes: ");
-          obj->Attributes()->str()->as<PyString>()->Print();
-          ConsoleTerminal::get_instance().debug("class attributes: ");
-          obj->Klass()->Attributes()->str()->as<PyString>()->Print();
-          ConsoleTerminal::get_instance().debug("mro: ");
-          obj->Klass()->Mro()->str()->as<PyString>()->Print();
-          for (Index i = 0; i < obj->Klass()->Mro()->Length(); i++) {
-            auto mro = obj->Klass()->Mro()->GetItem(i)->as<PyType>();
-            mro->Owner()->Name()->str()->as<PyString>()->Print();
-            mro->str()->as<PyString>()->Print();
-          }
-          throw std::runtime_error(
-            "AttributeError: '" +
-            obj->Klass()->Name()->as<PyString>()->ToCppString() +
-            "' object has no attribute '" + key->as<PyString>()->ToCppString() +
-            "'"
-          );
+          value = obj->getattr(key);
         }
-        stack.Push(value);
-        NextProgramCounter();
-        break;
+        if (value == nullptr) {
+          ThrowAttributeError(obj, key);
+        }
+        // 方法之后压入 self；其余属性之后压入一个空位，
+        // CALL_METHOD 见到空位时按普通调用处理
+        frame->stack.Push(std::move(value));
+        frame->stack.Push(bound ? std::move(obj) : nullptr);
+        frame->NextProgramCounter();
+        DISPATCH();
       }
-      case ByteCode::BUILD_LIST: {
-        auto size = std::get<Index>(oprt);
-        Collections::List<PyObjPtr> elements(size);
+      TARGET(BUILD_LIST) {
+        auto size = Index{oprt};
+        PyListElements elements(size);
         for (Index i = 0; i < size; i++) {
-          elements.Push(stack.Pop());
+          elements.Push(frame->stack.Pop());
         }
-        auto list = PyList::Create(elements);
-        stack.Push(list);
-        NextProgramCounter();
-        break;
+        auto list = PyList::Create(std::move(elements));
+        frame->stack.Push(list);
+        frame->NextProgramCounter();
+        DISPATCH();
       }
-      case ByteCode::BUILD_SLICE: {
-        auto step = stack.Pop();
-        auto end = stack.Pop();
-        auto start = stack.Pop();
+      TARGET(BUILD_SLICE) {
+        auto step = frame->stack.Pop();
+        auto end = frame->stack.Pop();
+        auto start = frame->stack.Pop();
         auto slice = CreatePySlice(start, end, step);
-        stack.Push(slice);
-        NextProgramCounter();
-        break;
+        frame->stack.Push(slice);
+        frame->NextProgramCounter();
+        DISPATCH();
       }
-      case ByteCode::JUMP_ABSOLUTE: {
-        SetProgramCounter(std::get<Index>(oprt));
-        break;
+      TARGET(JUMP_ABSOLUTE) {
+        frame->SetProgramCounter(oprt);
+        Runtime::GarbageCollector::Instance().MaybeCollect();
+        DISPATCH();
       }
-      case ByteCode::STORE_SUBSCR: {
-        auto index = stack.Pop();
-        auto obj = stack.Pop();
-        auto value = stack.Pop();
+      TARGET(STORE_SUBSCR) {
+        auto index = frame->stack.Pop();
+        auto obj = frame->stack.Pop();
+        auto value = frame->stack.Pop();
         obj->setitem(index, value);
-        NextProgramCounter();
-        break;
+        frame->NextProgramCounter();
+        DISPATCH();
       }
-      case ByteCode::GET_ITER: {
-        auto obj = stack.Pop();
+      TARGET(GET_ITER) {
+        auto obj = frame->stack.Pop();
         auto iter = obj->iter();
-        stack.Push(iter);
-        NextProgramCounter();
-        break;
+        frame->stack.Push(iter);
+        frame->NextProgramCounter();
+        DISPATCH();
       }
-      case ByteCode::FOR_ITER: {
-        auto iter = stack.Pop();
+      TARGET(FOR_ITER) {
+        auto iter = frame->stack.Pop();
         auto value = iter->next();
         if (value->is(Object::IterDoneKlass::Self())) {
-          SetProgramCounter(
-            static_cast<Index>(ProgramCounter() + std::get<uint64_t>(oprt))
-          );
+          frame->SetProgramCounter(frame->programCounter + oprt);
         } else {
-          stack.Push(iter);
-          stack.Push(value);
-          NextProgramCounter();
+          frame->stack.Push(iter);
+          frame->stack.Push(value);
+          frame->NextProgramCounter();
         }
-        break;
+        DISPATCH();
       }
-      case ByteCode::LOAD_BUILD_CLASS: {
-        stack.Push(
+      TARGET(LOAD_BUILD_CLASS) {
+        frame->stack.Push(
           Runtime::VirtualMachine::Instance().Builtins()->getitem(
             PyString::Create("__build_class__")
           )
         );
-        NextProgramCounter();
-        break;
+        frame->NextProgramCounter();
+        DISPATCH();
       }
-      case ByteCode::STORE_ATTR: {
-        auto index = std::get<Index>(oprt);
-        auto key = Code()->Names()->GetItem(index);
-        auto obj = stack.Pop();
-        auto value = stack.Pop();
-        obj->setattr(key, value);
-        NextProgramCounter();
-        break;
+      TARGET(STORE_ATTR) {
+        const auto& key = names[oprt];
+        auto obj = frame->stack.Pop();
+        auto value = frame->stack.Pop();
+        if (!StoreAttrCached(
+              attrCaches[attrCacheSlots[frame->programCounter]], obj, key, value
+            )) {
+          obj->setattr(key, value);
+        }
+        frame->NextProgramCounter();
+        DISPATCH();
       }
-      case ByteCode::NOP: {
-        NextProgramCounter();
-        break;
+      TARGET(NOP) {
+        frame->NextProgramCounter();
+        DISPATCH();
       }
-      case ByteCode::YIELD_VALUE: {
-        NextProgramCounter();
-        return PyGenerator::Create(shared_from_this()->as<PyFrame>());
+      TARGET(YIELD_VALUE) {
+        frame->NextProgramCounter();
+        return PyGenerator::Create(PyFramePtr(frame));
       }
-      case ByteCode::JUMP_FORWARD: {
-        SetProgramCounter(programCounter + std::get<Index>(oprt));
-        break;
+      TARGET(JUMP_FORWARD) {
+        frame->SetProgramCounter(frame->programCounter + oprt);
+        DISPATCH();
       }
-      case ByteCode::BUILD_MAP: {
-        auto size = std::get<Index>(oprt);
+      TARGET(BUILD_MAP) {
+        auto size = Index{oprt};
         auto map = PyDictionary::Create();
         for (Index i = 0; i < size; i++) {
-          auto value = stack.Pop();
-          auto key = stack.Pop();
+          auto value = frame->stack.Pop();
+          auto key = frame->stack.Pop();
           map->setitem(key, value);
         }
-        stack.Push(map);
-        NextProgramCounter();
-        break;
+        frame->stack.Push(map);
+        frame->NextProgramCounter();
+        DISPATCH();
+      }
+      TARGET(LOAD_FAST_LOAD_FAST) {
+        frame->stack.Push(frame->fastLocals[FirstIndexOf(oprt)]);
+        frame->stack.Push(frame->fastLocals[SecondIndexOf(oprt)]);
+        frame->NextProgramCounter();
+        DISPATCH();
+      }
+      TARGET(INCREMENT_FAST_CONST) {
+        auto index = FirstIndexOf(oprt);
+        auto step = consts[SecondIndexOf(oprt)];
+        frame->fastLocals[index] = frame->fastLocals[index]->add(step);
+        frame->NextProgramCounter();
+        DISPATCH();
+      }
+      TARGET(COMPARE_AND_BRANCH) {
+        auto right = frame->stack.Pop();
+        auto left = frame->stack.Pop();
+        if (!CompareToBool(CompareOpOf(oprt), left, right)) {
+          frame->SetProgramCounter(
+            static_cast<Index>(
+              static_cast<int64_t>(frame->programCounter) + BranchOffsetOf(oprt)
+            )
+          );
+        } else {
+          frame->NextProgramCounter();
+        }
+        DISPATCH();
+      }
+      TARGET(BINARY_ADD_INT) {
+        auto operands = frame->stack.Top(2);
+        if (!operands[0]->is(IntegerKlass::Self()) ||
+            !operands[1]->is(IntegerKlass::Self())) {
+          DEOPTIMIZE(BINARY_ADD)
+        }
+        auto right = frame->stack.Pop();
+        auto left = frame->stack.Pop();
+        const auto* lhs = left->unchecked_as<PyInteger>();
+        const auto* rhs = right->unchecked_as<PyInteger>();
+        frame->stack.Push(IntegerAdd(*lhs, *rhs));
+        frame->NextProgramCounter();
+        DISPATCH();
+      }
+      TARGET(BINARY_ADD_FLOAT) {
+        auto operands = frame->stack.Top(2);
+        if (!operands[0]->is(FloatKlass::Self()) ||
+            !operands[1]->is(FloatKlass::Self())) {
+          DEOPTIMIZE(BINARY_ADD)
+        }
+        auto right = frame->stack.Pop();
+        auto left = frame->stack.Pop();
+        const auto* lhs = left->unchecked_as<PyFloat>();
+        const auto* rhs = right->unchecked_as<PyFloat>();
+        frame->stack.Push(PyFloat::Create(lhs->Value() + rhs->Value()));
+        frame->NextProgramCounter();
+        DISPATCH();
+      }
+      TARGET(BINARY_ADD_STR) {
+        auto operands = frame->stack.Top(2);
+        if (!operands[0]->is(StringKlass::Self()) ||
+            !operands[1]->is(StringKlass::Self())) {
+          DEOPTIMIZE(BINARY_ADD)
+        }
+        auto right = StaticRefCast<PyString>(frame->stack.Pop());
+        auto left = StaticRefCast<PyString>(frame->stack.Pop());
+        frame->stack.Push(left->Add(right));
+        frame->NextProgramCounter();
+        DISPATCH();
       }
+      TARGET(BINARY_SUBTRACT_INT) {
+        auto operands = frame->stack.Top(2);
+        if (!operands[0]->is(IntegerKlass::Self()) ||
+            !operands[1]->is(IntegerKlass::Self())) {
+          DEOPTIMIZE(BINARY_SUBTRACT)
+        }
+        auto right = frame->stack.Pop();
+        auto left = frame->stack.Pop();
+        const auto* lhs = left->unchecked_as<PyInteger>();
+        const auto* rhs = right->unchecked_as<PyInteger>();
+        frame->stack.Push(IntegerSubtract(*lhs, *rhs));
+        frame->NextProgramCounter();
+        DISPATCH();
+      }
+      TARGET(BINARY_SUBTRACT_FLOAT) {
+        auto operands = frame->stack.Top(2);
+        if (!operands[0]->is(FloatKlass::Self()) ||
+            !operands[1]->is(FloatKlass::Self())) {
+          DEOPTIMIZE(BINARY_SUBTRACT)
+        }
+        auto right = frame->stack.Pop();
+        auto left = frame->stack.Pop();
+        const auto* lhs = left->unchecked_as<PyFloat>();
+        const auto* rhs = right->unchecked_as<PyFloat>();
+        frame->stack.Push(PyFloat::Create(lhs->Value() - rhs->Value()));
+        frame->NextProgramCounter();
+        DISPATCH();
+      }
+      TARGET(BINARY_MULTIPLY_INT) {
+        auto operands = frame->stack.Top(2);
+        if (!operands[0]->is(IntegerKlass::Self()) ||
+            !operands[1]->is(IntegerKlass::Self())) {
+          DEOPTIMIZE(BINARY_MULTIPLY)
+        }
+        auto right = frame->stack.Pop();
+        auto left = frame->stack.Pop();
+        const auto* lhs = left->unchecked_as<PyInteger>();
+        const auto* rhs = right->unchecked_as<PyInteger>();
+        frame->stack.Push(IntegerMultiply(*lhs, *rhs));
+        frame->NextProgramCounter();
+        DISPATCH();
+      }
+      TARGET(BINARY_MULTIPLY_FLOAT) {
+        auto operands = frame->stack.Top(2);
+        if (!operands[0]->is(FloatKlass::Self()) ||
+            !operands[1]->is(FloatKlass::Self())) {
+          DEOPTIMIZE(BINARY_MULTIPLY)
+        }
+        auto right = frame->stack.Pop();
+        auto left = frame->stack.Pop();
+        const auto* lhs = left->unchecked_as<PyFloat>();
+        const auto* rhs = right->unchecked_as<PyFloat>();
+        frame->stack.Push(PyFloat::Create(lhs->Value() * rhs->Value()));
+        frame->NextProgramCounter();
+        DISPATCH();
+      }
+      TARGET(COMPARE_LT_INT) {
+        auto operands = frame->stack.Top(2);
+        if (!operands[0]->is(IntegerKlass::Self()) ||
+            !operands[1]->is(IntegerKlass::Self())) {
+          DEOPTIMIZE(COMPARE_OP)
+        }
+        auto right = frame->stack.Pop();
+        auto left = frame->stack.Pop();
+        const auto* lhs = left->unchecked_as<PyInteger>();
+        const auto* rhs = right->unchecked_as<PyInteger>();
+        frame->stack.Push(PyBoolean::Create(IntegerLessThan(*lhs, *rhs)));
+        frame->NextProgramCounter();
+        DISPATCH();
+      }
+      TARGET(BINARY_SUBSCR_LIST_INT) {
+        auto operands = frame->stack.Top(2);
+        if (!operands[0]->is(ListKlass::Self()) ||
+            !operands[1]->is(IntegerKlass::Self())) {
+          DEOPTIMIZE(BINARY_SUBSCR)
+        }
+        const auto* list = operands[0]->unchecked_as<PyList>();
+        const auto* key = operands[1]->unchecked_as<PyInteger>();
+        // 越界和超大下标交给通用指令报错
+        if (!key->IsSmall()) {
+          DEOPTIMIZE(BINARY_SUBSCR)
+        }
+        const auto length = static_cast<int64_t>(list->Length());
+        auto index = key->SmallValue();
+        if (index < 0) {
+          index += length;
+        }
+        if (index < 0 || index >= length) {
+          DEOPTIMIZE(BINARY_SUBSCR)
+        }
+        auto value = list->GetItem(static_cast<Index>(index));
+        frame->stack.Drop(2);
+        frame->stack.Push(std::move(value));
+        frame->NextProgramCounter();
+        DISPATCH();
+      }
+#if KAUBO_COMPUTED_GOTO
+TARGET_UNKNOWN:
+#else
+      default:
+#endif
+  throw std::runtime_error(
+    "Unknown bytecode " + std::to_string(static_cast<uint32_t>(inst.code))
+  );
+#if KAUBO_COMPUTED_GOTO
+exit:
+  // 指令流执行完而没有遇到 RETURN_VALUE，按返回 None 处理
+  if (inlineDepth != 0) {
+    RETURN_TO_CALLER(PyNone::Create());
+    DISPATCH();
+  }
+#else
     }
   }
+#endif
   return PyNone::Create();
 }
 
+#if KAUBO_COMPUTED_GOTO
+#pragma GCC diagnostic pop
+#endif
+
+#undef TARGET
+#undef DISPATCH
+#undef ADAPTIVE_SPECIALIZE
+#undef DEOPTIMIZE
+#undef ENTER_CODE
+#undef RETURN_TO_CALLER
+
 PyObjPtr PyFrame::EvalAndDestroy() {
   auto result = Eval();
   Runtime::VirtualMachine::Instance().BackToParentFrame();
@@ -1,6 +1,6 @@
 #pragma once
 
-#include "Collections/Stack.h"
+#include "Collections/FixedStack.h"
 #include "Object/Container/PyDictionary.h"
 #include "Object/Container/PyList.h"
 #include "Object/Core/CoreHelper.h"
@@ -11,30 +11,63 @@
 #include "Object/Runtime/PyCode.h"
 #include "Object/Runtime/PyInst.h"
 
+namespace kaubo::Runtime {
+class FrameArena;
+}  // namespace kaubo::Runtime
+
 namespace kaubo::Object {
 class PyFrame;
-using PyFramePtr = std::shared_ptr<PyFrame>;
+using PyFramePtr = Ref<PyFrame>;
+
+class FrameKlass;
 
-class PyFrame : public PyObject {
+class PyFrame : public PyContainer {
  private:
-  Collections::Stack<PyObjPtr> stack;
+  // 槽位存储的来源，nullptr 表示在堆上分配
+  Runtime::FrameArena* arena;
+  Index nFastLocals;
+  Index nSlots;
+  // 局部变量槽位在前、操作数栈在后，共用一块连续存储；
+  // LOAD_FAST / STORE_FAST 按下标直接读写前 nFastLocals 个槽位
+  PyObjPtr* fastLocals;
+  Collections::FixedStack<PyObjPtr> stack;
   Index programCounter;
 
   PyCodePtr code;
+  // 按名字访问的局部变量，只在需要时创建，见 CurrentLocals()
   PyDictPtr locals;
   PyDictPtr globals;
-  PyListPtr fastLocals;
   PyFramePtr caller;
-  bool isParsed = false;
+
+  // Tracing 为 true 时每条指令执行前打印帧信息（verbose 模式）。
+  // 从 entry 开始执行，Python 函数之间的调用在同一个循环内切换帧
+  template <bool Tracing>
+  [[nodiscard]] static PyObjPtr EvalLoop(PyFrame* entry);
+
+ protected:
+  // 从分配区创建的帧析构后把内存还给分配区
+  void Dispose() noexcept override;
 
  public:
+  using KlassType = FrameKlass;
+
+  /**
+   * @brief arguments 起的 nArguments 个参数依次移入前几个槽位
+   */
   explicit PyFrame(
     PyCodePtr code,
     PyDictPtr locals,
     PyDictPtr globals,
-    PyListPtr fastLocals,
-    PyFramePtr caller
+    PyObjPtr* arguments,
+    Index nArguments,
+    PyFramePtr caller,
+    Runtime::FrameArena* arena = nullptr
   );
+  ~PyFrame() override;
+  PyFrame(const PyFrame&) = delete;
+  PyFrame& operator=(const PyFrame&) = delete;
+  PyFrame(PyFrame&&) = delete;
+  PyFrame& operator=(PyFrame&&) = delete;
 
   void SetProgramCounter(Index _pc);
 
@@ -54,10 +87,23 @@ class PyFrame : public PyObject {
 
   PyObjPtr StackPop() { return stack.Pop(); }
 
-  PyDictPtr CurrentLocals() const;
+  /**
+   * @brief 按名字访问的局部变量字典，首次访问时才创建
+   * @details 普通函数的局部变量都在槽位里，只有执行 LOAD_NAME / STORE_NAME
+   * 这类按名字访问的指令（例如类定义体）或被反射读取时才需要这个字典
+   */
+  const PyDictPtr& CurrentLocals() {
+    if (locals == nullptr) {
+      locals = PyDictionary::Create();
+    }
+    return locals;
+  }
 
   PyDictPtr CurrentGlobals() const;
 
+  /**
+   * @brief 以 PyList 形式返回局部变量槽位的副本，只供调试输出等反射场景使用
+   */
   PyListPtr CurrentFastLocals() const;
 
   bool Finished();
@@ -69,9 +115,17 @@ class PyFrame : public PyObject {
   [[nodiscard]] PyObjPtr Eval();
 
   [[nodiscard]] PyObjPtr EvalAndDestroy();
+
+  void Traverse(GcVisitor& visitor) override;
+
+  void ClearReferences() override;
+
+  [[nodiscard]] Index MemoryFootprint() const override {
+    return sizeof(PyFrame) + (nSlots + stack.Capacity()) * sizeof(PyObjPtr);
+  }
 };
 
-using PyFramePtr = std::shared_ptr<PyFrame>;
+using PyFramePtr = Ref<PyFrame>;
 
 PyFramePtr CreateModuleEntryFrame(const PyCodePtr& code);
 
@@ -80,6 +134,16 @@ PyFramePtr CreateFrameWithPyFunction(
   const PyListPtr& arguments
 );
 
+/**
+ * @brief 解释循环内联调用时使用，参数直接从调用方的栈上移入新帧，
+ * 不经过参数列表对象
+ */
+PyFramePtr CreateFrameWithPyFunction(
+  const PyFunctionPtr& function,
+  PyObjPtr* arguments,
+  Index nArguments
+);
+
 class FrameKlass : public KlassBase<FrameKlass> {
  public:
   explicit FrameKlass() = default;
@@ -96,15 +160,20 @@ class FrameKlass : public KlassBase<FrameKlass> {
   PyObjPtr repr(const PyObjPtr& obj) override;
 };
 
-void ParseByteCode(const PyCodePtr& code);
 void PrintFrame(const PyFramePtr& frame);
 inline PyFramePtr CreatePyFrame(
   const PyCodePtr& code,
   const PyDictPtr& locals,
   const PyDictPtr& globals,
-  const PyListPtr& fastLocals,
+  const PyListPtr& arguments,
   const PyFramePtr& caller
 ) {
-  return std::make_shared<PyFrame>(code, locals, globals, fastLocals, caller);
+  PyListElements copied(arguments->Length());
+  for (Index i = 0; i < arguments->Length(); i++) {
+    copied.Push(arguments->GetItem(i));
+  }
+  return MakeRef<PyFrame>(
+    code, locals, globals, copied.Data(), copied.Size(), caller
+  );
 }
 }  // namespace kaubo::Object
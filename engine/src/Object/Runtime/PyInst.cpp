@@ -4,6 +4,8 @@
 #include "Object/String/PyBytes.h"
 #include "Object/String/PyString.h"
 
+#include <limits>
+
 namespace kaubo::Object {
 
 PyInst::PyInst(ByteCode code, OperandKind operand)
@@ -52,6 +54,23 @@ PyObjPtr InstKlass::repr(const PyObjPtr& obj) {
   auto inst = obj->as<PyInst>();
   Collections::StringBuilder stringBuilder(Collections::ToString(inst->Code()));
   stringBuilder.Append(Collections::CreateStringWithCString(" "));
+  // 超级指令的操作数是拼接后的值，拆开后再输出
+  const auto packed = PackInst(inst).operand;
+  switch (inst->Code()) {
+    case ByteCode::LOAD_FAST_LOAD_FAST:
+    case ByteCode::INCREMENT_FAST_CONST:
+      stringBuilder.Append(Collections::ToString(FirstIndexOf(packed)));
+      stringBuilder.Append(Collections::CreateStringWithCString(" "));
+      stringBuilder.Append(Collections::ToString(SecondIndexOf(packed)));
+      return PyString::Create(stringBuilder.ToString());
+    case ByteCode::COMPARE_AND_BRANCH:
+      stringBuilder.Append(Collections::ToString(CompareOpOf(packed)));
+      stringBuilder.Append(Collections::CreateStringWithCString(" "));
+      stringBuilder.Append(Collections::ToString(BranchOffsetOf(packed)));
+      return PyString::Create(stringBuilder.ToString());
+    default:
+      break;
+  }
   std::visit(
     overload{
       [](None) {},
@@ -70,4 +89,224 @@ PyObjPtr InstKlass::repr(const PyObjPtr& obj) {
   return PyString::Create(stringBuilder.ToString());
 }
 
+OperandType OperandTypeOf(ByteCode code) {
+  switch (code) {
+    case ByteCode::LOAD_CONST:
+    case ByteCode::LOAD_NAME:
+    case ByteCode::STORE_NAME:
+    case ByteCode::LOAD_GLOBAL:
+    case ByteCode::STORE_GLOBAL:
+    case ByteCode::LOAD_FAST:
+    case ByteCode::STORE_FAST:
+    case ByteCode::LOAD_ATTR:
+    case ByteCode::STORE_ATTR:
+    case ByteCode::BUILD_LIST:
+    case ByteCode::BUILD_MAP:
+    case ByteCode::CALL_FUNCTION:
+    case ByteCode::LOAD_METHOD:
+    case ByteCode::CALL_METHOD:
+    case ByteCode::JUMP_ABSOLUTE:
+    case ByteCode::JUMP_FORWARD:
+    case ByteCode::FOR_ITER:
+    case ByteCode::LOAD_FAST_LOAD_FAST:
+    case ByteCode::INCREMENT_FAST_CONST:
+    case ByteCode::COMPARE_AND_BRANCH:
+      return OperandType::INDEX;
+    case ByteCode::COMPARE_OP:
+    case ByteCode::COMPARE_LT_INT:
+      return OperandType::COMPARE;
+    case ByteCode::POP_JUMP_IF_FALSE:
+    case ByteCode::POP_JUMP_IF_TRUE:
+      return OperandType::OFFSET;
+    case ByteCode::POP_TOP:
+    case ByteCode::NOP:
+    case ByteCode::UNARY_POSITIVE:
+    case ByteCode::UNARY_NEGATIVE:
+    case ByteCode::UNARY_NOT:
+    case ByteCode::UNARY_INVERT:
+    case ByteCode::BINARY_MATRIX_MULTIPLY:
+    case ByteCode::BINARY_POWER:
+    case ByteCode::BINARY_MULTIPLY:
+    case ByteCode::BINARY_MODULO:
+    case ByteCode::BINARY_ADD:
+    case ByteCode::BINARY_SUBTRACT:
+    case ByteCode::BINARY_SUBSCR:
+    case ByteCode::BINARY_FLOOR_DIVIDE:
+    case ByteCode::BINARY_TRUE_DIVIDE:
+    case ByteCode::STORE_SUBSCR:
+    case ByteCode::BINARY_LSHIFT:
+    case ByteCode::BINARY_RSHIFT:
+    case ByteCode::BINARY_AND:
+    case ByteCode::BINARY_XOR:
+    case ByteCode::BINARY_OR:
+    case ByteCode::GET_ITER:
+    case ByteCode::LOAD_BUILD_CLASS:
+    case ByteCode::RETURN_VALUE:
+    case ByteCode::YIELD_VALUE:
+    case ByteCode::MAKE_FUNCTION:
+    case ByteCode::BUILD_SLICE:
+    case ByteCode::BINARY_ADD_INT:
+    case ByteCode::BINARY_ADD_FLOAT:
+    case ByteCode::BINARY_ADD_STR:
+    case ByteCode::BINARY_SUBTRACT_INT:
+    case ByteCode::BINARY_SUBTRACT_FLOAT:
+    case ByteCode::BINARY_MULTIPLY_INT:
+    case ByteCode::BINARY_MULTIPLY_FLOAT:
+    case ByteCode::BINARY_SUBSCR_LIST_INT:
+      return OperandType::NONE;
+  }
+  throw std::runtime_error(
+    "OperandTypeOf(): unknown bytecode " +
+    std::to_string(static_cast<uint32_t>(code))
+  );
+}
+
+Inst PackInst(const PyInstPtr& inst) {
+  uint32_t operand = 0;
+  std::visit(
+    overload{
+      [](None) {},
+      [&operand](Index index) {
+        if (index > std::numeric_limits<uint32_t>::max()) {
+          throw std::runtime_error("PackInst(): operand out of range");
+        }
+        operand = static_cast<uint32_t>(index);
+      },
+      [&operand](CompareOp compOp) {
+        operand = static_cast<uint32_t>(compOp);
+      },
+      [&operand](int64_t offset) {
+        if (offset < std::numeric_limits<int32_t>::min() ||
+            offset > std::numeric_limits<int32_t>::max()) {
+          throw std::runtime_error("PackInst(): jump offset out of range");
+        }
+        operand = static_cast<uint32_t>(static_cast<int32_t>(offset));
+      }
+    },
+    inst->Operand()
+  );
+  return Inst{inst->Code(), operand};
+}
+
+PyInstPtr UnpackInst(const Inst& inst) {
+  switch (OperandTypeOf(inst.code)) {
+    case OperandType::NONE:
+      return MakeRef<PyInst>(inst.code);
+    case OperandType::INDEX:
+      return MakeRef<PyInst>(inst.code, Index{inst.operand});
+    case OperandType::COMPARE:
+      return MakeRef<PyInst>(
+        inst.code, static_cast<CompareOp>(inst.operand)
+      );
+    case OperandType::OFFSET:
+      return MakeRef<PyInst>(
+        inst.code, int64_t{static_cast<int32_t>(inst.operand)}
+      );
+  }
+  throw std::runtime_error("UnpackInst(): unknown operand type");
+}
+
+ByteCode GenericOf(ByteCode code) {
+  switch (code) {
+    case ByteCode::BINARY_ADD_INT:
+    case ByteCode::BINARY_ADD_FLOAT:
+    case ByteCode::BINARY_ADD_STR:
+      return ByteCode::BINARY_ADD;
+    case ByteCode::BINARY_SUBTRACT_INT:
+    case ByteCode::BINARY_SUBTRACT_FLOAT:
+      return ByteCode::BINARY_SUBTRACT;
+    case ByteCode::BINARY_MULTIPLY_INT:
+    case ByteCode::BINARY_MULTIPLY_FLOAT:
+      return ByteCode::BINARY_MULTIPLY;
+    case ByteCode::BINARY_SUBSCR_LIST_INT:
+      return ByteCode::BINARY_SUBSCR;
+    case ByteCode::COMPARE_LT_INT:
+      return ByteCode::COMPARE_OP;
+    default:
+      return code;
+  }
+}
+
+int64_t StackEffect(const Inst& inst, bool jump) {
+  switch (inst.code) {
+    case ByteCode::NOP:
+    case ByteCode::UNARY_POSITIVE:
+    case ByteCode::UNARY_NEGATIVE:
+    case ByteCode::UNARY_NOT:
+    case ByteCode::UNARY_INVERT:
+    case ByteCode::GET_ITER:
+    case ByteCode::LOAD_ATTR:
+    case ByteCode::JUMP_ABSOLUTE:
+    case ByteCode::JUMP_FORWARD:
+    // 值交给生成器取走，恢复执行时 Send 再压入一个值
+    case ByteCode::YIELD_VALUE:
+    case ByteCode::INCREMENT_FAST_CONST:
+      return 0;
+    case ByteCode::LOAD_CONST:
+    case ByteCode::LOAD_NAME:
+    case ByteCode::LOAD_GLOBAL:
+    case ByteCode::LOAD_FAST:
+    case ByteCode::LOAD_BUILD_CLASS:
+    // 弹出对象，压入方法和 self，或者属性值和一个空位
+    case ByteCode::LOAD_METHOD:
+      return 1;
+    case ByteCode::POP_TOP:
+    case ByteCode::STORE_NAME:
+    case ByteCode::STORE_GLOBAL:
+    case ByteCode::STORE_FAST:
+    case ByteCode::RETURN_VALUE:
+    case ByteCode::POP_JUMP_IF_FALSE:
+    case ByteCode::POP_JUMP_IF_TRUE:
+    case ByteCode::MAKE_FUNCTION:
+    case ByteCode::COMPARE_OP:
+    case ByteCode::BINARY_MATRIX_MULTIPLY:
+    case ByteCode::BINARY_POWER:
+    case ByteCode::BINARY_MULTIPLY:
+    case ByteCode::BINARY_MODULO:
+    case ByteCode::BINARY_ADD:
+    case ByteCode::BINARY_SUBTRACT:
+    case ByteCode::BINARY_SUBSCR:
+    case ByteCode::BINARY_FLOOR_DIVIDE:
+    case ByteCode::BINARY_TRUE_DIVIDE:
+    case ByteCode::BINARY_LSHIFT:
+    case ByteCode::BINARY_RSHIFT:
+    case ByteCode::BINARY_AND:
+    case ByteCode::BINARY_XOR:
+    case ByteCode::BINARY_OR:
+    case ByteCode::BINARY_ADD_INT:
+    case ByteCode::BINARY_ADD_FLOAT:
+    case ByteCode::BINARY_ADD_STR:
+    case ByteCode::BINARY_SUBTRACT_INT:
+    case ByteCode::BINARY_SUBTRACT_FLOAT:
+    case ByteCode::BINARY_MULTIPLY_INT:
+    case ByteCode::BINARY_MULTIPLY_FLOAT:
+    case ByteCode::BINARY_SUBSCR_LIST_INT:
+    case ByteCode::COMPARE_LT_INT:
+      return -1;
+    case ByteCode::LOAD_FAST_LOAD_FAST:
+      return 2;
+    case ByteCode::STORE_ATTR:
+    case ByteCode::BUILD_SLICE:
+    case ByteCode::COMPARE_AND_BRANCH:
+      return -2;
+    case ByteCode::STORE_SUBSCR:
+      return -3;
+    case ByteCode::BUILD_LIST:
+      return 1 - static_cast<int64_t>(inst.operand);
+    case ByteCode::BUILD_MAP:
+      return 1 - 2 * static_cast<int64_t>(inst.operand);
+    case ByteCode::CALL_FUNCTION:
+      return -static_cast<int64_t>(inst.operand);
+    case ByteCode::CALL_METHOD:
+      return -static_cast<int64_t>(inst.operand) - 1;
+    case ByteCode::FOR_ITER:
+      // 继续迭代时保留迭代器并压入新值，迭代结束时弹出迭代器
+      return jump ? -1 : 1;
+  }
+  throw std::runtime_error(
+    "StackEffect(): unknown bytecode " +
+    std::to_string(static_cast<uint32_t>(inst.code))
+  );
+}
+
 }  // namespace kaubo::Object
\ No newline at end of file
@@ -7,12 +7,16 @@
 
 namespace kaubo::Object {
 
+class InstKlass;
+
 class PyInst : public PyObject {
  private:
   ByteCode code;
   OperandKind operand = None();
 
  public:
+  using KlassType = InstKlass;
+
   explicit PyInst(ByteCode code, OperandKind operand = None());
 
   [[nodiscard]] ByteCode Code() const;
@@ -20,7 +24,7 @@ class PyInst : public PyObject {
   [[nodiscard]] OperandKind Operand() const;
 };
 
-using PyInstPtr = std::shared_ptr<PyInst>;
+using PyInstPtr = Ref<PyInst>;
 
 class InstKlass : public KlassBase<InstKlass> {
  public:
@@ -107,6 +111,16 @@ struct InstTraits<ByteCode::CALL_FUNCTION> {
   using operand_type = Index;
 };
 
+template <>
+struct InstTraits<ByteCode::LOAD_METHOD> {
+  using operand_type = Index;
+};
+
+template <>
+struct InstTraits<ByteCode::CALL_METHOD> {
+  using operand_type = Index;
+};
+
 template <>
 struct InstTraits<ByteCode::RETURN_VALUE> {
   using operand_type = void;
@@ -262,14 +276,111 @@ struct InstTraits<ByteCode::JUMP_FORWARD> {
   using operand_type = Index;
 };
 
+template <>
+struct InstTraits<ByteCode::LOAD_FAST_LOAD_FAST> {
+  using operand_type = Index;
+};
+
+template <>
+struct InstTraits<ByteCode::INCREMENT_FAST_CONST> {
+  using operand_type = Index;
+};
+
+template <>
+struct InstTraits<ByteCode::COMPARE_AND_BRANCH> {
+  using operand_type = Index;
+};
+
 template <ByteCode Op, typename T = typename InstTraits<Op>::operand_type>
 std::enable_if_t<std::is_same_v<T, void>, PyInstPtr> MakeInst() {
-  return std::make_shared<PyInst>(Op);
+  return MakeRef<PyInst>(Op);
 }
 
 template <ByteCode Op, typename T = typename InstTraits<Op>::operand_type>
 std::enable_if_t<!std::is_same_v<T, void>, PyInstPtr> MakeInst(T&& value) {
-  return std::make_shared<PyInst>(Op, std::forward<T>(value));
+  return MakeRef<PyInst>(Op, std::forward<T>(value));
+}
+
+/**
+ * @brief 紧凑的定长指令字
+ * @details PyCode 在首次执行前把指令解码成连续的 Inst 数组，
+ * PyFrame::Eval 直接按程序计数器读取，不再经过 PyList 和 PyInst。
+ * 操作数统一压成 32 位：名字/常量/跳转目标等下标直接存放，
+ * 比较运算符存放其枚举值，相对跳转偏移按有符号 32 位存放。
+ */
+struct Inst {
+  ByteCode code;
+  uint32_t operand;
+};
+
+/**
+ * @brief 指令操作数的种类，决定字节码中操作数的编码方式
+ */
+enum class OperandType : uint8_t { NONE, INDEX, COMPARE, OFFSET };
+
+OperandType OperandTypeOf(ByteCode code);
+
+Inst PackInst(const PyInstPtr& inst);
+
+/**
+ * @brief 从紧凑指令还原出 PyInst，仅用于 show_bc / PrintCode 等调试输出
+ */
+PyInstPtr UnpackInst(const Inst& inst);
+
+/**
+ * @brief 指令对操作数栈深度的影响
+ * @param jump 为 true 时返回跳转分支上的影响（仅 FOR_ITER 与顺序执行不同）
+ */
+int64_t StackEffect(const Inst& inst, bool jump = false);
+
+/**
+ * @brief 特化指令对应的通用指令，其他指令原样返回
+ * @details 特化只发生在执行期，还原 PyInst 列表（序列化、比较）时
+ * 通过它把特化指令换回通用形式
+ */
+ByteCode GenericOf(ByteCode code);
+
+/**
+ * @brief 自适应特化的预热计数
+ * @details 通用指令每执行一次计数减一，减到零时按当前操作数的类型尝试特化；
+ * 无法特化或特化后类型检查失败时，计数重置为退避值，避免反复尝试
+ */
+constexpr uint8_t ADAPTIVE_WARMUP = 8;
+constexpr uint8_t ADAPTIVE_BACKOFF = 64;
+
+/**
+ * @brief 超级指令的操作数编码
+ * @details LOAD_FAST_LOAD_FAST 与 INCREMENT_FAST_CONST 把两个 16 位下标
+ * 拼进一个操作数（低 16 位在前）；COMPARE_AND_BRANCH 低 8 位存比较运算符，
+ * 高 24 位存有符号的相对跳转偏移。放不下的指令序列不做合并。
+ */
+constexpr Index SUPER_INDEX_LIMIT = Index{1} << 16;
+constexpr int64_t SUPER_OFFSET_LIMIT = int64_t{1} << 23;
+
+inline uint32_t PackIndexPair(Index first, Index second) {
+  return static_cast<uint32_t>(first | (second << 16));
+}
+
+inline Index FirstIndexOf(uint32_t operand) {
+  return operand & 0xFFFFU;
+}
+
+inline Index SecondIndexOf(uint32_t operand) {
+  return operand >> 16;
+}
+
+inline uint32_t PackCompareBranch(CompareOp compareOp, int64_t offset) {
+  return (static_cast<uint32_t>(offset) << 8) |
+         static_cast<uint32_t>(compareOp);
+}
+
+inline CompareOp CompareOpOf(uint32_t operand) {
+  return static_cast<CompareOp>(operand & 0xFFU);
+}
+
+inline int64_t BranchOffsetOf(uint32_t operand) {
+  // 按有符号数算术右移，还原 24 位有符号偏移
+  return static_cast<int64_t>(static_cast<int32_t>(operand) >> 8);
 }
 
 }  // namespace kaubo::Object
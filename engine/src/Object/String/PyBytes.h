@@ -23,16 +23,21 @@ class BytesKlass : public KlassBase<BytesKlass> {
   PyObjPtr repr(const PyObjPtr& obj) override;
 };
 class PyBytes;
-using PyBytesPtr = std::shared_ptr<PyBytes>;
+using PyBytesPtr = Ref<PyBytes>;
 class PyBytes : public PyObject, public IObjectCreator<PyBytes> {
  private:
   Collections::String value;
 
  public:
+  using KlassType = BytesKlass;
+
   explicit PyBytes(Collections::String&& value)
     : PyObject(BytesKlass::Self()), value(std::move(value)) {}
 
   [[nodiscard]] const Collections::String& Value() { return value; }
+  [[nodiscard]] Index MemoryFootprint() const override {
+    return sizeof(PyBytes) + value.HeapBytes();
+  }
 };
 
 }  // namespace kaubo::Object
@@ -276,7 +276,7 @@ PyStrPtr PyString::Intern(const Collections::String& value) {
   if (iter != poolInstance.end()) {
     return iter->second;
   }
-  auto result = std::make_shared<PyString>(value);
+  auto result = MakeRef<PyString>(value);
   poolInstance[hash] = result;
   return result;
 }
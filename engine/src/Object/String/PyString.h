@@ -40,6 +40,8 @@ class PyString : public PyObject, public IObjectCreator<PyString> {
   }
 
  public:
+  using KlassType = StringKlass;
+
   explicit PyString(Collections::String value)
     : PyObject(StringKlass::Self()), m_value(std::move(value)) {}
 
@@ -69,6 +71,9 @@ class PyString : public PyObject, public IObjectCreator<PyString> {
   PyStrPtr Upper();
 
   Collections::String Value() const { return m_value.Copy(); }
+  [[nodiscard]] Index MemoryFootprint() const override {
+    return sizeof(PyString) + m_value.HeapBytes();
+  }
   static PyStrPtr Intern(const Collections::String& value);
   size_t Hash() { return m_value.HashValue(); }
 
@@ -80,7 +85,7 @@ class PyString : public PyObject, public IObjectCreator<PyString> {
   }
 };
 
-using PyStrPtr = std::shared_ptr<PyString>;
+using PyStrPtr = Ref<PyString>;
 
 PyObjPtr StringUpper(const PyObjPtr& args);
 
@@ -136,11 +136,12 @@ class BinaryFileParser {
     auto varNames = ReadObject()->as<Object::PyList>();
     auto name = ReadObject()->as<Object::PyString>();
     auto nLocals = ReadU64();
+    auto stackSize = ReadU64();
     auto isGenerator =
       static_cast<Object::Literal>(ReadU8()) == Object::Literal::TRUE_LITERAL;
     auto byteCode = ReadObject()->as<Object::PyBytes>();
-    return std::make_shared<Object::PyCode>(
-      byteCode, consts, names, varNames, name, nLocals, isGenerator
+    return Object::MakeRef<Object::PyCode>(
+      byteCode, consts, names, varNames, name, nLocals, stackSize, isGenerator
     );
   }
 };
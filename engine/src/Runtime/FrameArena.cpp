@@ -0,0 +1,53 @@
+#include "Runtime/FrameArena.h"
+
+#include <algorithm>
+#include <new>
+
+namespace kaubo::Runtime {
+
+FrameArena::~FrameArena() {
+  for (Index i = 0; i < chunks.Size(); i++) {
+    delete[] chunks[i].memory;
+  }
+}
+
+void FrameArena::Advance(Index size) {
+  // 当前块之后的块都是空的：大小够用就直接换过去，否则换成更大的新块
+  const Index next = chunks.Empty() ? 0 : current + 1;
+  const Index capacity = std::max(CHUNK_SIZE, size);
+  if (next < chunks.Size()) {
+    if (chunks[next].capacity < size) {
+      delete[] chunks[next].memory;
+      chunks[next] = Chunk{new std::byte[capacity], capacity};
+    }
+  } else {
+    chunks.Push(Chunk{new std::byte[capacity], capacity});
+  }
+  current = next;
+  top = 0;
+}
+
+void* FrameArena::Allocate(Index bytes) {
+  const Index payload = (bytes + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+  const Index size = sizeof(Header) + payload;
+  if (chunks.Empty() || top + size > chunks[current].capacity) {
+    Advance(size);
+  }
+  auto* header = new (chunks[current].memory + top)
+    Header{last, current, top, false};
+  top += size;
+  last = header;
+  return header + 1;
+}
+
+void FrameArena::Deallocate(void* pointer) {
+  auto* header = static_cast<Header*>(pointer) - 1;
+  header->released = true;
+  while (last != nullptr && last->released) {
+    current = last->chunk;
+    top = last->offset;
+    last = last->previous;
+  }
+}
+
+}  // namespace kaubo::Runtime
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "Collections/List.h"
+#include "Common.h"
+
+#include <cstddef>
+
+namespace kaubo::Runtime {
+
+/**
+ * @brief 函数帧的分配区
+ * @details 按块向系统申请连续内存，帧和它的槽位从当前块的顶部依次切出，
+ * 调用返回时按后进先出的顺序归还，块本身保留下来供后续调用复用。
+ * 归还顺序被打乱时（例如帧被别处多持有了一会儿），该块先记为已释放，
+ * 等压在它上面的块都归还后再一起退回
+ */
+class FrameArena {
+ public:
+  FrameArena() = default;
+  ~FrameArena();
+  FrameArena(const FrameArena&) = delete;
+  FrameArena& operator=(const FrameArena&) = delete;
+  FrameArena(FrameArena&&) = delete;
+  FrameArena& operator=(FrameArena&&) = delete;
+
+  [[nodiscard]] void* Allocate(Index bytes);
+
+  void Deallocate(void* pointer);
+
+ private:
+  static constexpr Index CHUNK_SIZE = Index{64} * 1024;
+  static constexpr Index ALIGNMENT = 16;
+
+  struct Chunk {
+    std::byte* memory;
+    Index capacity;
+  };
+
+  // 每次分配前的块头，串成一条从栈顶向下的链
+  struct alignas(ALIGNMENT) Header {
+    Header* previous;
+    Index chunk;   // 所在块的下标
+    Index offset;  // 分配前所在块的栈顶位置，退回时恢复
+    bool released;
+  };
+
+  void Advance(Index size);
+
+  Collections::List<Chunk> chunks;
+  Index current = 0;
+  Index top = 0;
+  Header* last = nullptr;
+};
+
+}  // namespace kaubo::Runtime
@@ -1,52 +1,197 @@
-// #include "Runtime/GarbageCollector.h"
-
-// #include "Object/Core/PyObject.h"
-// namespace kaubo::Runtime {
-
-// GarbageCollector& GarbageCollector::GetInstance() {
-//   static GarbageCollector instance;
-//   return instance;
-// }
-
-// void GarbageCollector::AddRoot(Object::PyObject* obj) {
-//   roots.insert(obj);
-// }
-
-// void GarbageCollector::RemoveRoot(Object::PyObject* obj) {
-//   roots.erase(obj);
-// }
-
-// void GarbageCollector::OnAllocation(Object::PyObject* obj) {
-//   allocatedObjects.insert(obj);
-// }
-
-// void GarbageCollector::Collect() {
-//   Mark();
-//   Sweep();
-// }
-
-// void GarbageCollector::Mark() {
-//   for (auto* root : roots) {
-//     root->Mark();
-//   }
-// }
-
-// bool GarbageCollector::IsMarked(Object::PyObject* obj) {
-//   return obj != nullptr && obj->IsMarked();
-// }
-
-// void GarbageCollector::Sweep() {
-//   auto allocIter = allocatedObjects.begin();
-//   while (allocIter != allocatedObjects.end()) {
-//     Object::PyObject* obj = *allocIter;
-//     if (!IsMarked(obj)) {
-//       //
-//       delete obj;
-//       allocIter = allocatedObjects.erase(allocIter);
-//     } else {
-//       ++allocIter;
-//     }
-//   }
-// }
-
-// }  // namespace kaubo::Runtime
\ No newline at end of file
+#include "Runtime/GarbageCollector.h"
+#include "Collections/List.h"
+
+#include <algorithm>
+
+namespace kaubo::Runtime {
+
+namespace {
+
+// 把 from 中的全部节点接到 to 的末尾，from 变为空
+void Splice(Object::GcLink* to, Object::GcLink* from) {
+  if (from->gcNext == from) {
+    return;
+  }
+  from->gcNext->gcPrev = to->gcPrev;
+  to->gcPrev->gcNext = from->gcNext;
+  from->gcPrev->gcNext = to;
+  to->gcPrev = from->gcPrev;
+  from->gcNext = from;
+  from->gcPrev = from;
+}
+
+Object::PyContainer* ContainerOf(Object::GcLink* link) {
+  return static_cast<Object::PyContainer*>(link);
+}
+
+}  // namespace
+
+/**
+ * @brief 第一遍：减去被回收这一代容器之间的引用
+ */
+class GarbageCollector::SubtractInternalReferences : public Object::GcVisitor {
+ protected:
+  void VisitObject(Object::PyObject* object) override {
+    auto* container = object->AsContainer();
+    if (container != nullptr &&
+        container->generation == GarbageCollector::GENERATIONS &&
+        container->gcRefs > 0) {
+      container->gcRefs--;
+    }
+  }
+};
+
+/**
+ * @brief 第二遍：从被外部引用的容器出发标记可达的容器
+ */
+class GarbageCollector::MarkReachable : public Object::GcVisitor {
+ public:
+  explicit MarkReachable(Collections::List<Object::PyContainer*>& worklist)
+    : worklist(worklist) {}
+
+ protected:
+  void VisitObject(Object::PyObject* object) override {
+    auto* container = object->AsContainer();
+    if (container != nullptr &&
+        container->generation == GarbageCollector::GENERATIONS &&
+        !container->IsMarked()) {
+      container->SetMarked(true);
+      worklist.Push(container);
+    }
+  }
+
+ private:
+  Collections::List<Object::PyContainer*>& worklist;
+};
+
+GarbageCollector::GarbageCollector() {
+  for (auto& head : generations) {
+    head.gcPrev = &head;
+    head.gcNext = &head;
+  }
+}
+
+void GarbageCollector::MergeYounger(Index generation) {
+  for (Index i = 0; i < generation; i++) {
+    Splice(&generations[generation], &generations[i]);
+    counts[generation] += counts[i];
+    counts[i] = 0;
+  }
+}
+
+Index GarbageCollector::Collect(Index generation) {
+  if (collecting) {
+    return 0;
+  }
+  collecting = true;
+  generation = std::min(generation, GENERATIONS - 1);
+  MergeYounger(generation);
+  auto* young = &generations[generation];
+  // 登记时计数为 0 的对象不归引用计数管理（例如正在构造），一律视为可达
+  for (auto* link = young->gcNext; link != young; link = link->gcNext) {
+    auto* container = ContainerOf(link);
+    container->generation = GENERATIONS;
+    container->gcRefs = container->RefCount();
+    if (container->gcRefs == 0) {
+      container->gcRefs = 1;
+    }
+  }
+  SubtractInternalReferences subtract;
+  for (auto* link = young->gcNext; link != young; link = link->gcNext) {
+    ContainerOf(link)->Traverse(subtract);
+  }
+  Collections::List<Object::PyContainer*> worklist;
+  for (auto* link = young->gcNext; link != young; link = link->gcNext) {
+    auto* container = ContainerOf(link);
+    if (container->gcRefs > 0 && !container->IsMarked()) {
+      container->SetMarked(true);
+      worklist.Push(container);
+    }
+  }
+  MarkReachable mark(worklist);
+  while (!worklist.Empty()) {
+    worklist.Pop()->Traverse(mark);
+  }
+  // 不可达的容器移到单独的链表并持有一个引用，其余的升入更老的一代
+  Object::GcLink unreachable;
+  unreachable.gcPrev = &unreachable;
+  unreachable.gcNext = &unreachable;
+  Collections::List<Object::PyObjPtr> garbage;
+  const Index older = std::min(generation + 1, GENERATIONS - 1);
+  for (auto* link = young->gcNext; link != young;) {
+    auto* container = ContainerOf(link);
+    link = link->gcNext;
+    if (container->IsMarked()) {
+      container->SetMarked(false);
+      container->generation = static_cast<uint8_t>(older);
+      continue;
+    }
+    counts[generation]--;
+    Unlink(container);
+    Link(&unreachable, container);
+    garbage.Push(Object::PyObjPtr(container));
+  }
+  if (older != generation) {
+    if (older == GENERATIONS - 1) {
+      longLivedPending += counts[generation];
+    }
+    Splice(&generations[older], young);
+    counts[older] += counts[generation];
+    counts[generation] = 0;
+  }
+  // 先拆开所有环，再放下持有的引用，对象随计数归零依次析构
+  for (Index i = 0; i < garbage.Size(); i++) {
+    garbage[i]->AsContainer()->ClearReferences();
+  }
+  const Index count = garbage.Size();
+  garbage = Collections::List<Object::PyObjPtr>();
+  // 析构时已从 unreachable 摘除；仍留下的说明有未报告的引用，交回最老一代
+  for (auto* link = unreachable.gcNext; link != &unreachable;) {
+    auto* container = ContainerOf(link);
+    link = link->gcNext;
+    Unlink(container);
+    container->generation = static_cast<uint8_t>(GENERATIONS - 1);
+    Link(&generations[GENERATIONS - 1], container);
+    counts[GENERATIONS - 1]++;
+  }
+  for (Index i = 0; i <= generation; i++) {
+    pending[i] = 0;
+  }
+  if (generation + 1 < GENERATIONS) {
+    pending[generation + 1]++;
+  }
+  if (generation == GENERATIONS - 1) {
+    longLivedTotal = counts[generation];
+    longLivedPending = 0;
+  }
+  collections[generation]++;
+  collected += count;
+  collecting = false;
+  return count;
+}
+
+void GarbageCollector::CollectAutomatically() {
+  Index generation = 0;
+  for (Index i = GENERATIONS - 1; i > 0; i--) {
+    // 与 CPython 一样，新升入最老一代的容器不足它的 25% 时不做完整回收，
+    // 否则不断增长的存活堆会让每次完整回收都重新遍历一遍，总耗时成平方
+    if (i == GENERATIONS - 1 && longLivedPending * 4 <= longLivedTotal) {
+      continue;
+    }
+    if (pending[i] >= thresholds[i]) {
+      generation = i;
+      break;
+    }
+  }
+  Collect(generation);
+}
+
+GarbageCollector::Stats GarbageCollector::GetStats() const {
+  Stats stats;
+  stats.collections = collections;
+  stats.tracked = counts;
+  stats.collected = collected;
+  return stats;
+}
+
+}  // namespace kaubo::Runtime
@@ -1,39 +1,128 @@
-// #pragma once
+#pragma once
 
-// #include "Object/Object.h"
+#include "Common.h"
+#include "Object/Core/PyObject.h"
 
-// #include <unordered_set>
+#include <array>
 
-// namespace kaubo::Runtime {
+/**
+ * @brief 最年轻一代的回收阈值
+ * @details 新登记的容器数（减去期间释放的）超过它时，在下一个安全点回收；
+ * 更老的两代在年轻一代被回收若干次后才一起回收；最老一代还要求上次完整
+ * 回收后新升入的容器超过它已有容器的 25%，避免堆持续增长时反复遍历整个堆
+ */
+#ifndef KAUBO_GC_THRESHOLD
+#define KAUBO_GC_THRESHOLD 700
+#endif
 
-// class GarbageCollector {
-//  public:
-//   static GarbageCollector& GetInstance();
+namespace kaubo::Runtime {
 
-//   // 注册根对象
-//   void AddRoot(Object::PyObject* obj);
-//   void RemoveRoot(Object::PyObject* obj);
+/**
+ * @brief 回收引用环的分代垃圾回收器
+ * @details 对象仍由引用计数释放，回收器只处理计数无法归零的引用环。
+ * 每次回收一代时先把每个容器的计数复制到 gcRefs，再减去这一代容器之间
+ * 的引用：减完仍大于 0 的容器被外部（栈、全局变量、Klass 或未参与遍历的
+ * 对象）引用，从它们出发能走到的容器都可达，剩下的就是只被环引用的垃圾。
+ * 回收只在解释循环的安全点（调用 Python 函数、向后跳转）和显式调用
+ * gcCollect() 时进行，此时所有仍在使用的对象都被计数引用持有。
+ * 只支持单线程运行
+ */
+class GarbageCollector {
+ public:
+  static constexpr Index GENERATIONS = 3;
 
-//   // 执行垃圾回收
-//   void Collect();
+  struct Stats {
+    std::array<Index, GENERATIONS> collections{};  // 各代被回收的次数
+    std::array<Index, GENERATIONS> tracked{};      // 各代当前登记的容器数
+    Index collected = 0;                           // 累计回收的容器数
+  };
 
-//   // 对象分配回调
-//   void OnAllocation(Object::PyObject* obj);
+  static GarbageCollector& Instance() {
+    // 静态对象析构时仍会摘除自己，回收器有意不在退出时析构
+    static auto* instance = new GarbageCollector();
+    return *instance;
+  }
 
-//   // 标记管理
-//   static bool IsMarked(Object::PyObject* obj);
+  GarbageCollector(const GarbageCollector&) = delete;
+  GarbageCollector& operator=(const GarbageCollector&) = delete;
+  GarbageCollector(GarbageCollector&&) = delete;
+  GarbageCollector& operator=(GarbageCollector&&) = delete;
+  ~GarbageCollector() = default;
 
-//  private:
-//   GarbageCollector() = default;
+  // 每个容器构造和析构时各调用一次，放在头文件里以便内联
+  void Track(Object::PyContainer* container) {
+    container->generation = 0;
+    Link(&generations[0], container);
+    counts[0]++;
+    pending[0]++;
+  }
 
-//   // 标记阶段
-//   void Mark();
+  void Untrack(Object::PyContainer* container) {
+    if (container->gcNext == nullptr) {
+      return;
+    }
+    if (container->generation < GENERATIONS) {
+      counts[container->generation]--;
+    }
+    if (container->generation == 0 && pending[0] > 0) {
+      pending[0]--;
+    }
+    Unlink(container);
+  }
 
-//   // 清除阶段
-//   void Sweep();
+  /**
+   * @brief 安全点：年轻一代超过阈值时回收
+   */
+  void MaybeCollect() {
+    if (pending[0] > thresholds[0] && !collecting) {
+      CollectAutomatically();
+    }
+  }
 
-//   std::unordered_set<Object::PyObject*> roots;
-//   std::unordered_set<Object::PyObject*> allocatedObjects;
-// };
+  /**
+   * @brief 回收 generation 及更年轻的各代，返回回收的容器数
+   */
+  Index Collect(Index generation = GENERATIONS - 1);
 
-// }  // namespace kaubo::Runtime
+  [[nodiscard]] Stats GetStats() const;
+
+ private:
+  class SubtractInternalReferences;
+  class MarkReachable;
+
+  GarbageCollector();
+
+  static void Link(Object::GcLink* head, Object::GcLink* link) {
+    link->gcPrev = head->gcPrev;
+    link->gcNext = head;
+    head->gcPrev->gcNext = link;
+    head->gcPrev = link;
+  }
+
+  static void Unlink(Object::GcLink* link) {
+    link->gcPrev->gcNext = link->gcNext;
+    link->gcNext->gcPrev = link->gcPrev;
+    link->gcPrev = nullptr;
+    link->gcNext = nullptr;
+  }
+
+  void CollectAutomatically();
+
+  // 把 generation 之前各代的链表并入 generation
+  void MergeYounger(Index generation);
+
+  // 以各代链表的哨兵为头尾的双向环形链表
+  std::array<Object::GcLink, GENERATIONS> generations;
+  std::array<Index, GENERATIONS> counts{};
+  // 第 0 代是新登记的容器数，其余是更年轻一代被回收的次数
+  std::array<Index, GENERATIONS> pending{};
+  std::array<Index, GENERATIONS> thresholds{KAUBO_GC_THRESHOLD, 10, 10};
+  std::array<Index, GENERATIONS> collections{};
+  // 上次完整回收后留在最老一代的容器数，以及此后新升入最老一代的容器数
+  Index longLivedTotal = 0;
+  Index longLivedPending = 0;
+  Index collected = 0;
+  bool collecting = false;
+};
+
+}  // namespace kaubo::Runtime
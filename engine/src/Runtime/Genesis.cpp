@@ -190,6 +190,22 @@ Object::PyDictPtr Genesis() {
     Object::PyString::Create("randint"),
     Object::PyNativeFunction::Create(Function::RandInt)
   );
+  builtins->Put(
+    Object::PyString::Create("gcCollect"),
+    Object::PyNativeFunction::Create(Function::GcCollect)
+  );
+  builtins->Put(
+    Object::PyString::Create("gcStats"),
+    Object::PyNativeFunction::Create(Function::GcStats)
+  );
+  builtins->Put(
+    Object::PyString::Create("memstats"),
+    Object::PyNativeFunction::Create(Function::MemStats)
+  );
+  builtins->Put(
+    Object::PyString::Create("poolStats"),
+    Object::PyNativeFunction::Create(Function::PoolStats)
+  );
 
   // 注册切片类型
   builtins->Put(
@@ -0,0 +1,98 @@
+#include "Runtime/MemoryStats.h"
+#include "Object/Core/PyObject.h"
+#include "Object/String/PyString.h"
+#include "Tools/EventBus/EventBus.h"
+
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+
+namespace kaubo::Runtime {
+
+#if KAUBO_MEMORY_STATS
+
+namespace {
+
+// 新登记的对象挂在表头；链表本身只是两个裸指针，不需要析构
+Object::PyObject* head = nullptr;
+
+}  // namespace
+
+void MemoryStats::Track(Object::PyObject* object) noexcept {
+  object->statsPrev = nullptr;
+  object->statsNext = head;
+  if (head != nullptr) {
+    head->statsPrev = object;
+  }
+  head = object;
+}
+
+void MemoryStats::Untrack(Object::PyObject* object) noexcept {
+  if (object->statsPrev != nullptr) {
+    object->statsPrev->statsNext = object->statsNext;
+  } else {
+    head = object->statsNext;
+  }
+  if (object->statsNext != nullptr) {
+    object->statsNext->statsPrev = object->statsPrev;
+  }
+}
+
+Collections::List<MemoryStats::Entry> MemoryStats::Collect() {
+  // 先汇总到标准库容器，遍历期间不创建新的对象
+  std::unordered_map<Object::Klass*, Entry> byKlass;
+  for (auto* object = head; object != nullptr; object = object->statsNext) {
+    auto* klass = object->Klass();
+    auto& entry = byKlass.try_emplace(klass, Entry{klass, 0, 0}).first->second;
+    entry.objects++;
+    entry.bytes += object->MemoryFootprint();
+  }
+  Collections::List<Entry> entries(byKlass.size());
+  for (const auto& [klass, entry] : byKlass) {
+    entries.Push(entry);
+  }
+  std::sort(
+    entries.Data(), entries.Data() + entries.Size(),
+    [](const Entry& lhs, const Entry& rhs) { return lhs.bytes > rhs.bytes; }
+  );
+  return entries;
+}
+
+#else
+
+void MemoryStats::Track(Object::PyObject* /*object*/) noexcept {}
+
+void MemoryStats::Untrack(Object::PyObject* /*object*/) noexcept {}
+
+Collections::List<MemoryStats::Entry> MemoryStats::Collect() {
+  return Collections::List<Entry>();
+}
+
+#endif
+
+void MemoryStats::Publish() {
+#if KAUBO_MEMORY_STATS
+  auto entries = Collect();
+  Index objects = 0;
+  Index bytes = 0;
+  for (Index i = 0; i < entries.Size(); i++) {
+    const auto& entry = entries[i];
+    auto name = entry.klass != nullptr && entry.klass->Name() != nullptr
+                  ? entry.klass->Name()->ToCppString()
+                  : std::string("<unnamed>");
+    EventBus::get_instance().publish(
+      EventType::LOG_DEBUG, "memory: " + name + " " +
+                              std::to_string(entry.objects) + " objects, " +
+                              std::to_string(entry.bytes) + " bytes"
+    );
+    objects += entry.objects;
+    bytes += entry.bytes;
+  }
+  EventBus::get_instance().publish(
+    EventType::LOG_DEBUG, "memory: total " + std::to_string(objects) +
+                            " objects, " + std::to_string(bytes) + " bytes"
+  );
+#endif
+}
+
+}  // namespace kaubo::Runtime
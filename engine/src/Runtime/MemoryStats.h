@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Collections/List.h"
+#include "Common.h"
+
+/**
+ * @brief 是否按 Klass 统计存活对象的个数和大致占用的内存
+ * @details 打开后每个对象构造时登记到一条全局链表、析构时摘除，
+ * memstats() 和退出时的 LOG_DEBUG 输出遍历这条链表汇总；
+ * 关闭时对象头不增加字段，构造和析构也没有额外的代码。
+ * 配置时用 cmake -DKAUBO_MEMORY_STATS=ON 打开
+ */
+#ifndef KAUBO_MEMORY_STATS
+#define KAUBO_MEMORY_STATS 0
+#endif
+
+namespace kaubo::Object {
+class PyObject;
+class Klass;
+}  // namespace kaubo::Object
+
+namespace kaubo::Runtime {
+
+/**
+ * @brief 按 Klass 汇总的内存统计
+ * @details 字节数是对象本身加上它在堆上直接持有的存储（列表的元素数组、
+ * 字符串的码元和码点缓存、矩阵数据、大整数的分段等），不含被引用的对象，
+ * 也不含分配器自身的开销，因此是近似值。只支持单线程运行
+ */
+class MemoryStats {
+ public:
+  static constexpr bool ENABLED = KAUBO_MEMORY_STATS != 0;
+
+  struct Entry {
+    Object::Klass* klass;
+    Index objects;
+    Index bytes;
+  };
+
+  static void Track(Object::PyObject* object) noexcept;
+
+  static void Untrack(Object::PyObject* object) noexcept;
+
+  /**
+   * @brief 遍历所有存活对象，按 Klass 汇总，字节数多的排在前面
+   * @details 未打开统计时返回空列表
+   */
+  [[nodiscard]] static Collections::List<Entry> Collect();
+
+  /**
+   * @brief 把汇总结果逐行发布为 LOG_DEBUG 事件
+   */
+  static void Publish();
+};
+
+}  // namespace kaubo::Runtime
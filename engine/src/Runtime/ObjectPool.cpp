@@ -0,0 +1,134 @@
+#include "Runtime/ObjectPool.h"
+#include "Object/Core/Klass.h"
+#include "Object/String/PyString.h"
+#include "Tools/EventBus/EventBus.h"
+
+#include <string>
+
+namespace kaubo::Runtime {
+
+namespace {
+
+// 线程退出时让出当前线程的池：没有存活对象就立即释放，否则等它们释放完
+struct PoolRetirer {
+  PoolRetirer() = default;
+  PoolRetirer(const PoolRetirer&) = delete;
+  PoolRetirer& operator=(const PoolRetirer&) = delete;
+  PoolRetirer(PoolRetirer&&) = delete;
+  PoolRetirer& operator=(PoolRetirer&&) = delete;
+  ~PoolRetirer() { ObjectPool::Retire(); }
+};
+
+}  // namespace
+
+ObjectPool::Pool* ObjectPool::CreatePool() {
+  static thread_local PoolRetirer retirer;
+  current = new Pool();
+  return current;
+}
+
+void* ObjectPool::AllocateFromChunk(Index index) {
+  auto* pool = current != nullptr ? current : CreatePool();
+  const Index size = (index + 1) * GRANULE;
+  if (pool->top == nullptr ||
+      static_cast<Index>(pool->end - pool->top) < size) {
+    // 块开头留出一个 GRANULE 存放块链表的指针，后面的块仍按 GRANULE 对齐
+    auto* chunk = new std::byte[CHUNK_SIZE];
+    auto* link = reinterpret_cast<FreeBlock*>(chunk);
+    link->next = pool->chunks;
+    pool->chunks = link;
+    pool->top = chunk + GRANULE;
+    pool->end = chunk + CHUNK_SIZE;
+  }
+  void* block = pool->top;
+  pool->top += size;
+  pool->live++;
+  auto& counters = pool->classes[index].counters;
+  if (++counters.live > counters.highWater) {
+    counters.highWater = counters.live;
+  }
+  return block;
+}
+
+void ObjectPool::Register(TypeCounters& counters) {
+  counters.registered = true;
+  RegisteredTypes().Push(&counters);
+}
+
+Collections::List<ObjectPool::TypeCounters*>& ObjectPool::RegisteredTypes() {
+  // 登记的计数都是各类型的线程局部成员，列表有意不在线程退出时析构：
+  // 之后析构的对象仍可能在这个线程上首次分配某个类型
+  static thread_local auto* types = new Collections::List<TypeCounters*>();
+  return *types;
+}
+
+const Collections::List<ObjectPool::TypeCounters*>& ObjectPool::Types() {
+  return RegisteredTypes();
+}
+
+std::array<ObjectPool::Counters, ObjectPool::SIZE_CLASSES>
+ObjectPool::SizeClassCounters() {
+  std::array<Counters, SIZE_CLASSES> counters{};
+  if (current == nullptr) {
+    return counters;
+  }
+  for (Index i = 0; i < SIZE_CLASSES; i++) {
+    counters[i] = current->classes[i].counters;
+  }
+  return counters;
+}
+
+void ObjectPool::Publish() {
+#if KAUBO_OBJECT_POOL
+  Index live = 0;
+  Index pooled = 0;
+  Index highWater = 0;
+  for (const auto& counters : SizeClassCounters()) {
+    live += counters.live;
+    pooled += counters.pooled;
+    highWater += counters.highWater;
+  }
+  EventBus::get_instance().publish(
+    EventType::LOG_DEBUG, "object pool: " + std::to_string(live) + " live, " +
+                            std::to_string(pooled) + " pooled, " +
+                            std::to_string(highWater) + " peak blocks"
+  );
+  const auto& types = Types();
+  for (Index i = 0; i < types.Size(); i++) {
+    const auto* counters = types[i];
+    auto* klass = counters->klass();
+    auto name = klass != nullptr && klass->Name() != nullptr
+                  ? klass->Name()->ToCppString()
+                  : std::string("<unnamed>");
+    EventBus::get_instance().publish(
+      EventType::LOG_DEBUG, "object pool: " + name + " " +
+                              std::to_string(counters->live) + " live, " +
+                              std::to_string(counters->highWater) + " peak"
+    );
+  }
+#endif
+}
+
+void ObjectPool::Retire() noexcept {
+  if (current == nullptr) {
+    return;
+  }
+  if (current->live == 0) {
+    Release();
+    return;
+  }
+  current->retired = true;
+}
+
+void ObjectPool::Release() noexcept {
+  auto* chunk = current->chunks;
+  while (chunk != nullptr) {
+    auto* next = chunk->next;
+    delete[] reinterpret_cast<std::byte*>(chunk);
+    chunk = next;
+  }
+  delete current;
+  current = nullptr;
+}
+
+}  // namespace kaubo::Runtime
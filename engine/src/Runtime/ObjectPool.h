@@ -0,0 +1,171 @@
+#pragma once
+
+#include "Collections/List.h"
+#include "Common.h"
+#include "Object/Core/Ref.h"
+
+#include <array>
+#include <cstddef>
+#include <new>
+
+/**
+ * @brief 是否让常用对象类型从对象池分配
+ * @details 关闭后这些类型退回全局的 operator new/delete，
+ * 便于用 AddressSanitizer 等工具逐个对象检查内存错误。
+ * 池按线程划分，对象跨线程释放会挂到错误的池上，
+ * 所以打开 KAUBO_ATOMIC_REFCOUNT 时默认关闭，也不能同时打开
+ */
+#ifndef KAUBO_OBJECT_POOL
+#define KAUBO_OBJECT_POOL (!KAUBO_ATOMIC_REFCOUNT)
+#endif
+
+#if KAUBO_OBJECT_POOL && KAUBO_ATOMIC_REFCOUNT
+#error "KAUBO_OBJECT_POOL requires objects to be freed on their own thread"
+#endif
+
+namespace kaubo::Object {
+class Klass;
+}  // namespace kaubo::Object
+
+namespace kaubo::Runtime {
+
+/**
+ * @brief 按尺寸分级的对象池
+ * @details 不超过 MAX_SIZE 的对象按 GRANULE 向上取整分到各个尺寸级，
+ * 每级维护一条空闲块链表：释放的块挂回链表，下次分配同级对象时直接取出，
+ * 链表为空时从当前块（CHUNK_SIZE 大小）顶部切出新的块。
+ * 池和计数都按线程各自独立，不需要加锁；一个线程分配的对象应在同一线程释放。
+ * 线程退出（主线程则是进程退出）时若已没有存活的对象，立即整体释放所有块；
+ * 否则（例如驻留字符串被静态对象持有）等最后一个对象释放时再整体释放
+ */
+class ObjectPool {
+ public:
+  static constexpr Index GRANULE = 16;
+  static constexpr Index SIZE_CLASSES = 16;
+  static constexpr Index MAX_SIZE = GRANULE * SIZE_CLASSES;
+  static constexpr Index CHUNK_SIZE = Index{64} * 1024;
+  static constexpr bool ENABLED = KAUBO_OBJECT_POOL != 0;
+
+  struct Counters {
+    Index live = 0;       // 已分配、尚未释放的块数
+    Index pooled = 0;     // 挂在空闲链表上等待复用的块数
+    Index highWater = 0;  // live 的最大值
+  };
+
+  /**
+   * @brief 一种对象类型在当前线程的计数，在该类型第一次分配时登记
+   */
+  struct TypeCounters {
+    Object::Klass* (*klass)();  // 取得该类型的 Klass，用于报告
+    Index live;
+    Index highWater;
+    bool registered;
+  };
+
+  static void* Allocate(Index bytes) {
+    if (bytes > MAX_SIZE) {
+      return ::operator new(bytes);
+    }
+    const Index index = (bytes - 1) / GRANULE;
+    auto* pool = current;
+    if (pool != nullptr) {
+      auto& sizeClass = pool->classes[index];
+      if (sizeClass.free != nullptr) {
+        auto* block = sizeClass.free;
+        sizeClass.free = block->next;
+        sizeClass.counters.pooled--;
+        pool->live++;
+        if (++sizeClass.counters.live > sizeClass.counters.highWater) {
+          sizeClass.counters.highWater = sizeClass.counters.live;
+        }
+        return block;
+      }
+    }
+    return AllocateFromChunk(index);
+  }
+
+  static void Deallocate(void* pointer, Index bytes) noexcept {
+    if (bytes > MAX_SIZE) {
+      ::operator delete(pointer);
+      return;
+    }
+    auto* pool = current != nullptr ? current : CreatePool();
+    auto& sizeClass = pool->classes[(bytes - 1) / GRANULE];
+    auto* block = static_cast<FreeBlock*>(pointer);
+    block->next = sizeClass.free;
+    sizeClass.free = block;
+    sizeClass.counters.live--;
+    sizeClass.counters.pooled++;
+    if (--pool->live == 0 && pool->retired) {
+      Release();
+    }
+  }
+
+  static void CountAllocation(TypeCounters& counters) {
+    if (++counters.live > counters.highWater) {
+      counters.highWater = counters.live;
+      if (!counters.registered) {
+        Register(counters);
+      }
+    }
+  }
+
+  static void CountDeallocation(TypeCounters& counters) noexcept {
+    counters.live--;
+  }
+
+  /**
+   * @brief 当前线程各尺寸级的计数，下标 i 对应 (i + 1) * GRANULE 字节
+   */
+  [[nodiscard]] static std::array<Counters, SIZE_CLASSES> SizeClassCounters();
+
+  /**
+   * @brief 当前线程已登记的对象类型计数，按第一次分配的先后排列
+   */
+  [[nodiscard]] static const Collections::List<TypeCounters*>& Types();
+
+  /**
+   * @brief 把当前线程的总计和各类型计数逐行发布为 LOG_DEBUG 事件
+   */
+  static void Publish();
+
+  /**
+   * @brief 线程退出时调用：没有存活对象就整体释放，否则等最后一个对象释放
+   */
+  static void Retire() noexcept;
+
+ private:
+  struct FreeBlock {
+    FreeBlock* next;
+  };
+
+  struct SizeClass {
+    FreeBlock* free = nullptr;
+    Counters counters;
+  };
+
+  struct Pool {
+    std::array<SizeClass, SIZE_CLASSES> classes;
+    FreeBlock* chunks = nullptr;  // 所有块串成的链表，每块开头是链表指针
+    std::byte* top = nullptr;     // 当前块中尚未切出的部分
+    std::byte* end = nullptr;
+    Index live = 0;
+    bool retired = false;  // 线程已退出，只等剩余对象释放
+  };
+
+  static Pool* CreatePool();
+
+  static void* AllocateFromChunk(Index index);
+
+  static void Register(TypeCounters& counters);
+
+  static Collections::List<TypeCounters*>& RegisteredTypes();
+
+  // 整体释放当前线程的池
+  static void Release() noexcept;
+
+  // 常量初始化，访问时不经过线程局部变量的初始化检查
+  inline static thread_local Pool* current = nullptr;
+};
+
+}  // namespace kaubo::Runtime
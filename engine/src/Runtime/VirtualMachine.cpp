@@ -1,6 +1,7 @@
 #include "Runtime/VirtualMachine.h"
 #include "Function/BuiltinFunction.h"
 #include "Object/Container/PyDictionary.h"
+#include "Object/Container/PyList.h"
 #include "Object/Core/PyNone.h"
 #include "Object/Core/PyObject.h"
 #include "Object/Core/PyType.h"
@@ -8,20 +9,22 @@
 #include "Object/Function/PyMethod.h"
 #include "Object/Function/PyNativeFunction.h"
 #include "Object/Iterator/PyGenerator.h"
+#include "Object/Number/PyInteger.h"
 #include "Object/Object.h"
 #include "Object/Runtime/PyCode.h"
 #include "Object/Runtime/PyFrame.h"
 #include "Runtime/EventLoop.h"
 #include "Runtime/GarbageCollector.h"
 #include "Runtime/Genesis.h"
+#include "Runtime/MemoryStats.h"
+#include "Runtime/ObjectPool.h"
+#include "Tools/EventBus/EventBus.h"
 
 namespace kaubo::Runtime {
 
 VirtualMachine::VirtualMachine() {
   frame = nullptr;
   builtins = Genesis();
-  // // 初始化垃圾回收器
-  // GarbageCollector::GetInstance();
 }
 
 VirtualMachine& VirtualMachine::Instance() {
@@ -43,6 +46,21 @@ void VirtualMachine::Run(const Object::PyCodePtr& code) {
     throw std::runtime_error("Module code did not return None");
   }
   EventLoop::Instance().Run();
+  auto stats = Object::GetSmallIntegerCacheStats();
+  EventBus::get_instance().publish(
+    EventType::LOG_DEBUG, "small int cache: " + std::to_string(stats.hits) +
+                            " hits, " + std::to_string(stats.misses) + " misses"
+  );
+  auto gcStats = GarbageCollector::Instance().GetStats();
+  EventBus::get_instance().publish(
+    EventType::LOG_DEBUG,
+    "gc: " + std::to_string(gcStats.collections[0]) + "/" +
+      std::to_string(gcStats.collections[1]) + "/" +
+      std::to_string(gcStats.collections[2]) + " collections, " +
+      std::to_string(gcStats.collected) + " containers collected"
+  );
+  ObjectPool::Publish();
+  MemoryStats::Publish();
 }
 
 namespace Evaluator {
@@ -58,6 +76,11 @@ Object::PyObjPtr CallMethod( // NOLINT(misc-no-recursion)
 ) {
   auto owner = func->Owner();
   auto function = func->Method();
+  if (function->is(Object::NativeFunctionKlass::Self())) {
+    return function->as<Object::PyNativeFunction>()->Call(
+      owner, arguments->Data(), arguments->Length()
+    );
+  }
   return InvokeCallable(
     function, arguments->Prepend(owner)->as<Object::PyList>()
   );
@@ -102,9 +125,40 @@ Object::PyObjPtr InvokeCallable( // NOLINT( misc-no-recursion)
   Function::DebugPrint(func);
   throw std::runtime_error("Unknown function type");
 }
+Object::PyObjPtr Vectorcall(  // NOLINT(misc-no-recursion)
+  const Object::PyObjPtr& func,
+  const Object::PyObjPtr* args,
+  Index nargs
+) {
+  if (func->is(Object::NativeFunctionKlass::Self())) {
+    return func->as<Object::PyNativeFunction>()->Call(nullptr, args, nargs);
+  }
+  if (func->is(Object::MethodKlass::Self())) {
+    auto method = func->as<Object::PyMethod>();
+    return Vectorcall(method->Method(), method->Owner(), args, nargs);
+  }
+  auto arguments = Collections::List<Object::PyObjPtr>(nargs, args);
+  return InvokeCallable(func, Object::PyList::Create(std::move(arguments)));
+}
+Object::PyObjPtr Vectorcall(  // NOLINT(misc-no-recursion)
+  const Object::PyObjPtr& func,
+  const Object::PyObjPtr& self,
+  const Object::PyObjPtr* args,
+  Index nargs
+) {
+  if (func->is(Object::NativeFunctionKlass::Self())) {
+    return func->as<Object::PyNativeFunction>()->Call(self, args, nargs);
+  }
+  Collections::List<Object::PyObjPtr> arguments(nargs + 1);
+  arguments.Push(self);
+  for (Index i = 0; i < nargs; i++) {
+    arguments.Push(args[i]);
+  }
+  return InvokeCallable(func, Object::PyList::Create(std::move(arguments)));
+}
 }  // namespace Evaluator
 
-Object::PyDictPtr VirtualMachine::Builtins() const {
+const Object::PyDictPtr& VirtualMachine::Builtins() const {
   return builtins;
 }
 
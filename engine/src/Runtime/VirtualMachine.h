@@ -5,6 +5,7 @@
 #include "Object/Object.h"
 #include "Object/Runtime/PyCode.h"
 #include "Object/Runtime/PyFrame.h"
+#include "Runtime/FrameArena.h"
 
 namespace kaubo::Runtime {
 
@@ -27,10 +28,32 @@ Object::PyObjPtr InvokeCallable(
   const Object::PyObjPtr& func,
   const Object::PyListPtr& arguments
 );
+/**
+ * @brief 向量调用：参数是调用方连续存放的 nargs 个对象，通常就是操作数栈
+ * @details 原生函数和绑定到原生函数的方法直接在这段参数上调用，
+ * 不构造参数列表；其余可调用对象在这里装成列表后交给 InvokeCallable
+ */
+Object::PyObjPtr Vectorcall(
+  const Object::PyObjPtr& func,
+  const Object::PyObjPtr* args,
+  Index nargs
+);
+/**
+ * @brief 带接收者的向量调用，等价于调用 func 绑定到 self 后的方法
+ * @details 供 CALL_METHOD 和绑定方法使用，不创建 PyMethod
+ */
+Object::PyObjPtr Vectorcall(
+  const Object::PyObjPtr& func,
+  const Object::PyObjPtr& self,
+  const Object::PyObjPtr* args,
+  Index nargs
+);
 }  // namespace Evaluator
 
 class VirtualMachine {
  private:
+  // 先于 frame 构造、后于它析构，保证帧链释放时分配区仍然有效
+  FrameArena frameArena;
   Object::PyFramePtr frame;
   Object::PyDictPtr builtins;
   explicit VirtualMachine();
@@ -40,7 +63,12 @@ class VirtualMachine {
 
   static void Run(const Object::PyCodePtr& code);
 
-  [[nodiscard]] Object::PyDictPtr Builtins() const;
+  [[nodiscard]] const Object::PyDictPtr& Builtins() const;
+
+  /**
+   * @brief 普通函数帧使用的分配区，生成器帧不从这里分配
+   */
+  [[nodiscard]] FrameArena& Frames() { return frameArena; }
 
   void BackToParentFrame();
   void SetFrame(const Object::PyFramePtr& child);
@@ -122,6 +122,36 @@ TEST(Integer, IntegerBitWiseXor) {
   ASSERT_EQ(c.ToString().ToCppString(), "4");
 }
 
+TEST(Integer, IntegerBitWiseWithNegative) {
+  Integer a = CreateIntegerWithCString("-12");
+  Integer b = CreateIntegerWithCString("10");
+  ASSERT_EQ(a.BitWiseAnd(b).ToString().ToCppString(), "0");
+  ASSERT_EQ(a.BitWiseOr(b).ToString().ToCppString(), "-2");
+  ASSERT_EQ(a.BitWiseXor(b).ToString().ToCppString(), "-2");
+  ASSERT_EQ(a.BitWiseNot().ToString().ToCppString(), "11");
+  a = CreateIntegerWithCString("-123456789012345678901234567890");
+  b = CreateIntegerWithCString("98765432109876543210");
+  ASSERT_EQ(a.BitWiseAnd(b).ToString().ToCppString(), "20213295392617428010");
+  ASSERT_EQ(
+    a.BitWiseOr(b).ToString().ToCppString(), "-123456788933793542183975452690"
+  );
+  ASSERT_EQ(
+    a.BitWiseAnd(b.Negate()).ToString().ToCppString(),
+    "-123456789032558974293851995898"
+  );
+  ASSERT_EQ(
+    a.BitWiseOr(b.Negate()).ToString().ToCppString(), "-78552136717259115202"
+  );
+}
+
+TEST(Integer, IntegerDivModWithNegative) {
+  Integer a = CreateIntegerWithCString("-7");
+  Integer b = CreateIntegerWithCString("2");
+  ASSERT_EQ(a.Divide(b).ToString().ToCppString(), "-4");
+  ASSERT_EQ(a.Modulo(b).ToString().ToCppString(), "1");
+  ASSERT_EQ(b.Modulo(a).ToString().ToCppString(), "-5");
+}
+
 TEST(Integer, ExtraAdd) {
   ASSERT_TRUE(CreateIntegerWithCString("1234567890")
                 .Add(CreateIntegerWithCString("9876543210"))
@@ -19,9 +19,9 @@ class PyIntegerTest : public ::testing::Test {
  protected:
   void SetUp() override {
     // 初始化操作，如创建测试对象等
-    integer1 = std::dynamic_pointer_cast<PyInteger>(PyInteger::Create(10ULL));
-    integer2 = std::dynamic_pointer_cast<PyInteger>(PyInteger::Create(20ULL));
-    integer3 = std::dynamic_pointer_cast<PyInteger>(PyInteger::Create(10ULL));
+    integer1 = DynamicRefCast<PyInteger>(PyInteger::Create(10ULL));
+    integer2 = DynamicRefCast<PyInteger>(PyInteger::Create(20ULL));
+    integer3 = DynamicRefCast<PyInteger>(PyInteger::Create(10ULL));
   }
 
   PyIntPtr integer1;
@@ -39,7 +39,7 @@ TEST_F(PyIntegerTest, TestValue) {
 TEST_F(PyIntegerTest, TestAdd) {
   auto result = IntegerKlass::Self()->add(integer1, integer2);
   EXPECT_TRUE(
-    std::dynamic_pointer_cast<PyInteger>(result)->Equal(
+    DynamicRefCast<PyInteger>(result)->Equal(
       PyInteger::Create(CreateIntegerWithCString("30"))
     )
   );
@@ -48,7 +48,7 @@ TEST_F(PyIntegerTest, TestAdd) {
 TEST_F(PyIntegerTest, TestSub) {
   auto result = IntegerKlass::Self()->sub(integer2, integer1);
   EXPECT_TRUE(
-    std::dynamic_pointer_cast<PyInteger>(result)->Equal(
+    DynamicRefCast<PyInteger>(result)->Equal(
       PyInteger::Create(CreateIntegerWithCString("10"))
     )
   );
@@ -57,7 +57,7 @@ TEST_F(PyIntegerTest, TestSub) {
 TEST_F(PyIntegerTest, TestMul) {
   auto result = IntegerKlass::Self()->mul(integer1, integer2);
   EXPECT_TRUE(
-    std::dynamic_pointer_cast<PyInteger>(result)->Equal(
+    DynamicRefCast<PyInteger>(result)->Equal(
       PyInteger::Create(CreateIntegerWithCString("200"))
     )
   );
@@ -66,7 +66,7 @@ TEST_F(PyIntegerTest, TestMul) {
 TEST_F(PyIntegerTest, TestFloorDiv) {
   auto result = IntegerKlass::Self()->floordiv(integer2, integer1);
   EXPECT_TRUE(
-    std::dynamic_pointer_cast<PyInteger>(result)->Equal(
+    DynamicRefCast<PyInteger>(result)->Equal(
       PyInteger::Create(CreateIntegerWithCString("2"))
     )
   );
@@ -75,38 +75,38 @@ TEST_F(PyIntegerTest, TestFloorDiv) {
 TEST_F(PyIntegerTest, TestRepr) {
   auto result = IntegerKlass::Self()->repr(integer1);
   EXPECT_TRUE(
-    std::dynamic_pointer_cast<PyString>(result)->Equal(PyString::Create("10"))
+    DynamicRefCast<PyString>(result)->Equal(PyString::Create("10"))
   );
 }
 
 TEST_F(PyIntegerTest, TestGt) {
   auto result = IntegerKlass::Self()->gt(integer2, integer1);
-  EXPECT_TRUE(std::dynamic_pointer_cast<PyBoolean>(result)->Value());
+  EXPECT_TRUE(DynamicRefCast<PyBoolean>(result)->Value());
 }
 
 TEST_F(PyIntegerTest, TestLt) {
   auto result = IntegerKlass::Self()->lt(integer1, integer2);
-  EXPECT_TRUE(std::dynamic_pointer_cast<PyBoolean>(result)->Value());
+  EXPECT_TRUE(DynamicRefCast<PyBoolean>(result)->Value());
 }
 
 TEST_F(PyIntegerTest, TestEq) {
   auto result = IntegerKlass::Self()->eq(integer1, integer3);
-  EXPECT_TRUE(std::dynamic_pointer_cast<PyBoolean>(result)->Value());
+  EXPECT_TRUE(DynamicRefCast<PyBoolean>(result)->Value());
 }
 
 TEST_F(PyIntegerTest, TestGe) {
   auto result = IntegerKlass::Self()->ge(integer2, integer1);
-  EXPECT_TRUE(std::dynamic_pointer_cast<PyBoolean>(result)->Value());
+  EXPECT_TRUE(DynamicRefCast<PyBoolean>(result)->Value());
 }
 
 TEST_F(PyIntegerTest, TestLe) {
   auto result = IntegerKlass::Self()->le(integer1, integer2);
-  EXPECT_TRUE(std::dynamic_pointer_cast<PyBoolean>(result)->Value());
+  EXPECT_TRUE(DynamicRefCast<PyBoolean>(result)->Value());
 }
 
 TEST_F(PyIntegerTest, TestNe) {
   auto result = IntegerKlass::Self()->ne(integer1, integer2);
-  EXPECT_TRUE(std::dynamic_pointer_cast<PyBoolean>(result)->Value());
+  EXPECT_TRUE(DynamicRefCast<PyBoolean>(result)->Value());
 }
 
 TEST_F(PyIntegerTest, TestSerialize) {
@@ -14,13 +14,13 @@ namespace kaubo::Object {
 class PyStringTest : public ::testing::Test {
  protected:
   void SetUp() override {
-    str1 = std::dynamic_pointer_cast<PyString>(
+    str1 = DynamicRefCast<PyString>(
       PyString::Create(Collections::CreateStringWithCString("hello"))
     );
-    str2 = std::dynamic_pointer_cast<PyString>(
+    str2 = DynamicRefCast<PyString>(
       PyString::Create(Collections::CreateStringWithCString("world"))
     );
-    str3 = std::dynamic_pointer_cast<PyString>(
+    str3 = DynamicRefCast<PyString>(
       PyString::Create(Collections::CreateStringWithCString("hello"))
     );
   }
@@ -31,7 +31,7 @@ class PyStringTest : public ::testing::Test {
 };
 
 TEST_F(PyStringTest, Constructor) {
-  PyStrPtr str = std::dynamic_pointer_cast<PyString>(
+  PyStrPtr str = DynamicRefCast<PyString>(
     PyString::Create(Collections::CreateStringWithCString("test"))
   );
   EXPECT_EQ(str->ToCppString(), "test");
@@ -39,25 +39,25 @@ TEST_F(PyStringTest, Constructor) {
 
 TEST_F(PyStringTest, Add) {
   auto result = StringKlass::Self()->add(str1, str2);
-  auto pystr = std::dynamic_pointer_cast<PyString>(result);
+  auto pystr = DynamicRefCast<PyString>(result);
   EXPECT_EQ(pystr->ToCppString(), "helloworld");
 }
 
 TEST_F(PyStringTest, Repr) {
   auto result = StringKlass::Self()->repr(str1);
-  auto pystr = std::dynamic_pointer_cast<PyString>(result);
+  auto pystr = DynamicRefCast<PyString>(result);
   EXPECT_EQ(pystr->ToCppString(), "\'hello\'");
 }
 
 TEST_F(PyStringTest, Eq) {
   {
     auto result = StringKlass::Self()->eq(str1, str2);
-    auto pybool = std::dynamic_pointer_cast<PyBoolean>(result);
+    auto pybool = DynamicRefCast<PyBoolean>(result);
     EXPECT_FALSE(pybool->Value());
   }
   {
     auto result = StringKlass::Self()->eq(str1, str3);
-    auto pybool = std::dynamic_pointer_cast<PyBoolean>(result);
+    auto pybool = DynamicRefCast<PyBoolean>(result);
     EXPECT_TRUE(pybool->Value());
   }
 }